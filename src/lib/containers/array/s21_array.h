@@ -4,12 +4,20 @@
 #include <algorithm>
 #include <cstddef>
 #include <initializer_list>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
+#include <utility>
+
+#include "./../common/s21_access.h"
+#include "./../simd/s21_simd.h"
 
 namespace s21 {
-    template <typename T, size_t length>
+    // The elements live on the heap, so the array takes an Allocator like the other containers.
+    template <typename T, size_t length, typename Allocator = std::allocator<T>>
     class array {
         using value_type = T;
+        using allocator_type = Allocator;
         using reference = T&;
         using const_reference = const T&;
         using iterator = T*;
@@ -17,37 +25,64 @@ namespace s21 {
         using size_type = size_t;
 
     private:
+        using alloc_traits = std::allocator_traits<Allocator>;
+
         T* m_data;
         size_type m_size;
-        void init_array(size_t size) {
-            m_data = new value_type[size]();
+        [[no_unique_address]] Allocator m_alloc;
+
+        // Allocates size elements, value-initialized or copied from source.
+        void init_array(size_t size, const T* source = nullptr) {
+            T* data = size ? alloc_traits::allocate(m_alloc, size) : nullptr;
+            size_type built = 0;
+            try {
+                for(; built < size; ++built) {
+                    if(source) {
+                        alloc_traits::construct(m_alloc, data + built, source[built]);
+                    } else {
+                        alloc_traits::construct(m_alloc, data + built);
+                    }
+                }
+            }
+            catch(...) {
+                for(size_type i = 0; i < built; ++i) alloc_traits::destroy(m_alloc, data + i);
+                if(data) alloc_traits::deallocate(m_alloc, data, size);
+                throw;
+            }
+            m_data = data;
             m_size = size;
         }
 
+        void release() noexcept {
+            for(size_type i = 0; i < m_size; ++i) alloc_traits::destroy(m_alloc, m_data + i);
+            if(m_data) alloc_traits::deallocate(m_alloc, m_data, m_size);
+            m_data = nullptr;
+            m_size = 0;
+        }
+
     public:
-        array() : m_data(nullptr), m_size(length) { init_array(length); };
+        array() : array(Allocator()) {}
 
-        explicit array(std::initializer_list<value_type> const& items) : m_data(nullptr), m_size(0) {
-            init_array(items.size());
-            m_size = items.size();
-            std::copy(items.begin(), items.end(), m_data);
+        explicit array(const Allocator& alloc) : m_data(nullptr), m_size(0), m_alloc(alloc) { init_array(length); };
+
+        explicit array(std::initializer_list<value_type> const& items, const Allocator& alloc = Allocator()) :
+            m_data(nullptr), m_size(0), m_alloc(alloc) {
+            init_array(items.size(), items.begin());
         };
 
-        array(const array& a) {
-            init_array(a.m_size);
-            m_size = a.m_size;
-            std::copy(a.m_data, a.m_data + a.m_size, m_data);
+        array(const array& a) :
+            m_data(nullptr), m_size(0), m_alloc(alloc_traits::select_on_container_copy_construction(a.m_alloc)) {
+            init_array(a.m_size, a.m_data);
         };
 
-        array(array&& a) noexcept : m_data(a.m_data), m_size(a.m_size) {
+        array(array&& a) noexcept : m_data(a.m_data), m_size(a.m_size), m_alloc(std::move(a.m_alloc)) {
             a.m_data = nullptr;
             a.m_size = 0;
         };
 
-        ~array() {
-            delete[] m_data;
-            m_size = 0;
-        }
+        ~array() { release(); }
+
+        allocator_type get_allocator() const noexcept { return m_alloc; }
 
         iterator begin() const { return m_data; };
         iterator end() const { return m_data + m_size; };
@@ -69,22 +104,22 @@ namespace s21 {
 
         // cppcheck-suppress functionConst
         reference front() {
-            if(m_size == 0) throw std::out_of_range("array is empty");
+            check_access(m_size > 0, "array is empty");
             return m_data[0];
         };
 
         const_reference front() const {
-            if(m_size == 0) throw std::out_of_range("array is empty");
+            check_access(m_size > 0, "array is empty");
             return m_data[0];
         };
 
         // cppcheck-suppress functionConst
         reference back() {
-            if(m_size == 0) throw std::out_of_range("array is empty");
+            check_access(m_size > 0, "array is empty");
             return m_data[m_size - 1];
         };
         const_reference back() const {
-            if(m_size == 0) throw std::out_of_range("array is empty");
+            check_access(m_size > 0, "array is empty");
             return m_data[m_size - 1];
         };
 
@@ -97,23 +132,37 @@ namespace s21 {
         size_type max_size() const { return m_size; };
 
         void swap(array& a) noexcept {
+            if constexpr(alloc_traits::propagate_on_container_swap::value) std::swap(m_alloc, a.m_alloc);
             std::swap(m_data, a.m_data);
             std::swap(m_size, a.m_size);
         };
         // cppcheck-suppress passedByValue
-        void fill(const_reference value) const { std::fill(begin(), end(), value); };
+        void fill(const_reference value) const {
+            if constexpr(simd::vectorizable<T>)
+                simd::fill(begin(), end(), value);
+            else
+                std::fill(begin(), end(), value);
+        };
 
         array& operator=(const array& a) {
             if(this != &a) {
-                delete[] m_data;
-                init_array(a.m_size);
-                std::copy(a.m_data, a.m_data + a.m_size, m_data);
+                release();
+                if constexpr(alloc_traits::propagate_on_container_copy_assignment::value) m_alloc = a.m_alloc;
+                init_array(a.m_size, a.m_data);
             }
             return *this;
         };
-        array& operator=(array&& a) noexcept {
+        // Steals a's storage; with unequal, non-propagating allocators the elements are copied instead.
+        array& operator=(array&& a) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                             alloc_traits::is_always_equal::value) {
             if(this != &a) {
-                delete[] m_data;
+                release();
+                if constexpr(alloc_traits::propagate_on_container_move_assignment::value) m_alloc = std::move(a.m_alloc);
+                if(!(m_alloc == a.m_alloc)) {
+                    init_array(a.m_size, a.m_data);
+                    a.release();
+                    return *this;
+                }
                 m_data = a.m_data;
                 m_size = a.m_size;
                 a.m_data = nullptr;
@@ -123,10 +172,22 @@ namespace s21 {
         };
 
         // cppcheck-suppress passedByValue
-        reference operator[](size_type pos) { return at(pos); };
+        reference operator[](size_type pos) {
+            check_access(pos < m_size, "Index out of range");
+            return m_data[pos];
+        };
         // cppcheck-suppress passedByValue
-        const_reference operator[](size_type pos) const { return at(pos); };
+        const_reference operator[](size_type pos) const {
+            check_access(pos < m_size, "Index out of range");
+            return m_data[pos];
+        };
     };
+
+    // Arrays whose elements come from a std::pmr::memory_resource.
+    namespace pmr {
+        template <typename T, size_t length>
+        using array = s21::array<T, length, std::pmr::polymorphic_allocator<T>>;
+    } // namespace pmr
 } // namespace s21
 
 #endif
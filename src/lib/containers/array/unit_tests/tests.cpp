@@ -3,9 +3,11 @@
 //
 #include <gtest/gtest.h>
 
+#include <memory_resource>
 #include <stdexcept>
 
 #include "./../s21_array.h"
+#include "./../testing_include/counting_resource.h"
 #include "./../testing_include/test_include.h"
 
 using namespace s21;
@@ -76,6 +78,14 @@ TEST(arrayTest, AtException) {
     EXPECT_THROW(a.at(5), std::out_of_range);
 }
 
+TEST(arrayTest, SubscriptCheckedInDebug) {
+    array<int, 5> a{1, 2, 3, 4, 5};
+    EXPECT_EQ(a[4], 5);
+#if S21_CHECKED_ACCESS
+    EXPECT_THROW(a[5], std::out_of_range);
+#endif
+}
+
 TEST(arrayTest, Back) {
     array<int, 5> a{1, 2, 3, 4, 5};
     EXPECT_EQ(a.back(), 5);
@@ -138,6 +148,18 @@ TEST(arrayTest, Fill) {
     for(size_t i = 0; i < a.size(); ++i) { EXPECT_EQ(a[i], ans[i]); }
 }
 
+TEST(arrayTest, PmrArrayAllocatesFromResource) {
+    CountingResource resource;
+    {
+        s21::pmr::array<int, 8> a(&resource);
+        a.fill(3);
+        s21::pmr::array<int, 8> b(std::move(a));
+        EXPECT_EQ(b.at(7), 3);
+        EXPECT_EQ(resource.allocations, (size_t) 1);
+    }
+    EXPECT_EQ(resource.live_bytes, (size_t) 0);
+}
+
 int main(int argc, char** argv) {
     testing::InitGoogleTest(&argc, argv);
     UTIL(RUN_ALL_TESTS());
@@ -0,0 +1,102 @@
+// Compares art_map against s21::map<std::string, V> on string keys with long shared prefixes
+// (URL paths) and on uniformly random ones (UUIDs): inserts, lookups, a prefix scan and erases.
+//
+// Usage: bench_s21_art_map [element_count]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "./../../map/s21_map.h"
+#include "./../s21_art_map.h"
+
+namespace {
+    template <typename Body>
+    double measure(Body body) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(stop - start).count();
+    }
+
+    void report(const char* container, const char* phase, size_t ops, double seconds) {
+        std::printf("%-20s %-14s %10.2f Mops/s\n", container, phase, ops / seconds / 1e6);
+    }
+
+    std::vector<std::string> url_keys(size_t n, std::mt19937& gen) {
+        const char* hosts[] = {"https://example.com", "https://api.example.com", "https://cdn.example.org"};
+        const char* sections[] = {"/users/", "/orders/", "/products/", "/static/img/"};
+        std::vector<std::string> keys;
+        keys.reserve(n);
+        for(size_t i = 0; i < n; ++i) {
+            keys.push_back(std::string(hosts[gen() % 3]) + sections[gen() % 4] + std::to_string(i) + "/details");
+        }
+        return keys;
+    }
+
+    std::vector<std::string> uuid_keys(size_t n, std::mt19937& gen) {
+        const char digits[] = "0123456789abcdef";
+        std::vector<std::string> keys;
+        keys.reserve(n);
+        for(size_t i = 0; i < n; ++i) {
+            std::string key(36, '-');
+            for(size_t j = 0; j < key.size(); ++j) {
+                if(j != 8 && j != 13 && j != 18 && j != 23) key[j] = digits[gen() % 16];
+            }
+            keys.push_back(key);
+        }
+        return keys;
+    }
+
+    template <typename Map>
+    void run(const char* container, const std::vector<std::string>& keys, const std::vector<std::string>& misses, const std::string& prefix) {
+        const size_t n = keys.size();
+        Map table;
+        long long checksum = 0;
+
+        report(container, "insert", n, measure([&] {
+                   for(const std::string& key : keys) table.insert(key, 1);
+               }));
+        report(container, "find hit", n, measure([&] {
+                   for(const std::string& key : keys) checksum += table.find(key)->second;
+               }));
+        report(container, "find miss", n, measure([&] {
+                   for(const std::string& key : misses) checksum += table.find(key) == table.end();
+               }));
+        size_t scanned = 0;
+        double seconds = measure([&] {
+            for(auto it = table.lower_bound(prefix); it != table.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it) ++scanned;
+        });
+        report(container, "prefix scan", scanned, seconds);
+        report(container, "erase", n, measure([&] {
+                   for(const std::string& key : keys) table.erase(table.find(key));
+               }));
+
+        if(checksum == 42) std::printf("\n");
+    }
+
+    void run_all(const char* title, std::vector<std::string> keys, std::vector<std::string> misses, const std::string& prefix, std::mt19937& gen) {
+        std::shuffle(keys.begin(), keys.end(), gen);
+        std::printf("%s, %zu keys\n", title, keys.size());
+        run<s21::art_map<int>>("s21::art_map", keys, misses, prefix);
+        run<s21::map<std::string, int>>("s21::map", keys, misses, prefix);
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    std::mt19937 gen(42);
+
+    std::vector<std::string> urls = url_keys(n, gen);
+    std::vector<std::string> url_misses = urls;
+    for(std::string& key : url_misses) key.back() = '!';
+    run_all("URL paths", urls, url_misses, "https://api.example.com/orders/", gen);
+
+    std::vector<std::string> uuids = uuid_keys(n, gen);
+    run_all("UUIDs", uuids, uuid_keys(n, gen), "a", gen);
+    return 0;
+}
@@ -0,0 +1,728 @@
+#ifndef S21_CONTAINERS_ART_MAP
+#define S21_CONTAINERS_ART_MAP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "./../vector/s21_vector.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define S21_ART_MAP_SSE2 1
+#endif
+
+namespace s21 {
+    // Ordered map from strings to TValue, stored as an adaptive radix tree (Leis et al., ICDE 2013).
+    // Every inner node branches on one key byte and grows through four layouts as it fills up:
+    //   Node4/Node16 - sorted byte and child arrays (Node16 searched with one SSE2 compare);
+    //   Node48       - a 256-entry byte index into 48 child slots;
+    //   Node256      - a direct child array.
+    // Chains of single-child nodes are collapsed into a per-node prefix (path compression), so a
+    // lookup touches at most one node per distinguishing byte and costs O(key length) whatever the
+    // size of the map; the full key is compared once, at the leaf. A key that is a prefix of other
+    // keys lives in the terminal slot of the node where it ends.
+    //
+    // Iteration follows byte order, matching map<std::string, TValue>. Inserts and erases keep
+    // iterators to other elements valid.
+    template <typename TValue>
+    class art_map {
+    public:
+        using key_type = std::string;
+        using mapped_type = TValue;
+        using value_type = std::pair<const key_type, mapped_type>;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using size_type = size_t;
+
+    private:
+        enum class m_Kind : uint8_t { leaf, node4, node16, node48, node256 };
+
+        struct m_Inner;
+
+        struct m_Node {
+            m_Kind kind;
+            int16_t edge; // byte this node hangs under in its parent, -1 for a terminal slot or the root
+            m_Inner* parent;
+
+            explicit m_Node(m_Kind node_kind) : kind(node_kind), edge(-1), parent(nullptr) {}
+        };
+
+        struct m_Leaf : m_Node {
+            value_type item;
+
+            template <typename... Args>
+            explicit m_Leaf(Args&&... args) : m_Node(m_Kind::leaf), item(std::forward<Args>(args)...) {}
+        };
+
+        struct m_Inner : m_Node {
+            std::string prefix;
+            m_Leaf* terminal;
+            uint16_t count;
+
+            explicit m_Inner(m_Kind node_kind) : m_Node(node_kind), prefix(), terminal(nullptr), count(0) {}
+        };
+
+        struct m_Node4 : m_Inner {
+            uint8_t keys[4];
+            m_Node* children[4];
+
+            m_Node4() : m_Inner(m_Kind::node4), keys(), children() {}
+        };
+
+        struct m_Node16 : m_Inner {
+            uint8_t keys[16];
+            m_Node* children[16];
+
+            m_Node16() : m_Inner(m_Kind::node16), keys(), children() {}
+        };
+
+        struct m_Node48 : m_Inner {
+            uint8_t index[256]; // slot + 1, 0 when the byte has no child
+            m_Node* children[48];
+
+            m_Node48() : m_Inner(m_Kind::node48), index(), children() {}
+        };
+
+        struct m_Node256 : m_Inner {
+            m_Node* children[256];
+
+            m_Node256() : m_Inner(m_Kind::node256), children() {}
+        };
+
+        m_Node* m_root;
+        size_type m_size;
+
+        static bool is_leaf(const m_Node* node) noexcept { return node->kind == m_Kind::leaf; }
+        static m_Leaf* as_leaf(m_Node* node) noexcept { return static_cast<m_Leaf*>(node); }
+        static m_Inner* as_inner(m_Node* node) noexcept { return static_cast<m_Inner*>(node); }
+        static uint8_t byte_at(std::string_view key, size_type depth) noexcept { return static_cast<uint8_t>(key[depth]); }
+
+        static size_type capacity_of(m_Kind kind) noexcept {
+            switch(kind) {
+                case m_Kind::node4: return 4;
+                case m_Kind::node16: return 16;
+                case m_Kind::node48: return 48;
+                default: return 256;
+            }
+        }
+
+        static m_Inner* make_inner(m_Kind kind) {
+            switch(kind) {
+                case m_Kind::node4: return new m_Node4();
+                case m_Kind::node16: return new m_Node16();
+                case m_Kind::node48: return new m_Node48();
+                default: return new m_Node256();
+            }
+        }
+
+        static void delete_node(m_Node* node) noexcept {
+            switch(node->kind) {
+                case m_Kind::leaf: delete static_cast<m_Leaf*>(node); break;
+                case m_Kind::node4: delete static_cast<m_Node4*>(node); break;
+                case m_Kind::node16: delete static_cast<m_Node16*>(node); break;
+                case m_Kind::node48: delete static_cast<m_Node48*>(node); break;
+                case m_Kind::node256: delete static_cast<m_Node256*>(node); break;
+            }
+        }
+
+        // Slot holding the child under byte, or nullptr.
+        static m_Node** find_child(m_Inner* node, uint8_t byte) noexcept {
+            switch(node->kind) {
+                case m_Kind::node4: {
+                    m_Node4* n = static_cast<m_Node4*>(node);
+                    for(uint16_t i = 0; i < n->count; ++i) {
+                        if(n->keys[i] == byte) return &n->children[i];
+                    }
+                    return nullptr;
+                }
+                case m_Kind::node16: {
+                    m_Node16* n = static_cast<m_Node16*>(node);
+#ifdef S21_ART_MAP_SSE2
+                    __m128i keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(n->keys));
+                    int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)), keys)) & ((1 << n->count) - 1);
+                    return mask ? &n->children[__builtin_ctz(mask)] : nullptr;
+#else
+                    for(uint16_t i = 0; i < n->count; ++i) {
+                        if(n->keys[i] == byte) return &n->children[i];
+                    }
+                    return nullptr;
+#endif
+                }
+                case m_Kind::node48: {
+                    m_Node48* n = static_cast<m_Node48*>(node);
+                    return n->index[byte] ? &n->children[n->index[byte] - 1] : nullptr;
+                }
+                default: {
+                    m_Node256* n = static_cast<m_Node256*>(node);
+                    return n->children[byte] ? &n->children[byte] : nullptr;
+                }
+            }
+        }
+
+        // First child under a byte >= from (from may be 256), or nullptr.
+        static m_Node* next_child(const m_Inner* node, int from) noexcept {
+            switch(node->kind) {
+                case m_Kind::node4:
+                case m_Kind::node16: {
+                    const uint8_t* keys = node->kind == m_Kind::node4 ? static_cast<const m_Node4*>(node)->keys : static_cast<const m_Node16*>(node)->keys;
+                    m_Node* const* children =
+                        node->kind == m_Kind::node4 ? static_cast<const m_Node4*>(node)->children : static_cast<const m_Node16*>(node)->children;
+                    for(uint16_t i = 0; i < node->count; ++i) {
+                        if(keys[i] >= from) return children[i];
+                    }
+                    return nullptr;
+                }
+                case m_Kind::node48: {
+                    const m_Node48* n = static_cast<const m_Node48*>(node);
+                    for(int byte = from; byte < 256; ++byte) {
+                        if(n->index[byte]) return n->children[n->index[byte] - 1];
+                    }
+                    return nullptr;
+                }
+                default: {
+                    const m_Node256* n = static_cast<const m_Node256*>(node);
+                    for(int byte = from; byte < 256; ++byte) {
+                        if(n->children[byte]) return n->children[byte];
+                    }
+                    return nullptr;
+                }
+            }
+        }
+
+        // Last child under a byte <= from (from may be -1), or nullptr.
+        static m_Node* prev_child(const m_Inner* node, int from) noexcept {
+            switch(node->kind) {
+                case m_Kind::node4:
+                case m_Kind::node16: {
+                    const uint8_t* keys = node->kind == m_Kind::node4 ? static_cast<const m_Node4*>(node)->keys : static_cast<const m_Node16*>(node)->keys;
+                    m_Node* const* children =
+                        node->kind == m_Kind::node4 ? static_cast<const m_Node4*>(node)->children : static_cast<const m_Node16*>(node)->children;
+                    for(uint16_t i = node->count; i-- > 0;) {
+                        if(keys[i] <= from) return children[i];
+                    }
+                    return nullptr;
+                }
+                case m_Kind::node48: {
+                    const m_Node48* n = static_cast<const m_Node48*>(node);
+                    for(int byte = from; byte >= 0; --byte) {
+                        if(n->index[byte]) return n->children[n->index[byte] - 1];
+                    }
+                    return nullptr;
+                }
+                default: {
+                    const m_Node256* n = static_cast<const m_Node256*>(node);
+                    for(int byte = from; byte >= 0; --byte) {
+                        if(n->children[byte]) return n->children[byte];
+                    }
+                    return nullptr;
+                }
+            }
+        }
+
+        // Adds child under byte; node must have room.
+        static void put_child(m_Inner* node, uint8_t byte, m_Node* child) noexcept {
+            child->parent = node;
+            child->edge = byte;
+            switch(node->kind) {
+                case m_Kind::node4:
+                case m_Kind::node16: {
+                    uint8_t* keys = node->kind == m_Kind::node4 ? static_cast<m_Node4*>(node)->keys : static_cast<m_Node16*>(node)->keys;
+                    m_Node** children = node->kind == m_Kind::node4 ? static_cast<m_Node4*>(node)->children : static_cast<m_Node16*>(node)->children;
+                    uint16_t pos = 0;
+                    while(pos < node->count && keys[pos] < byte) ++pos;
+                    std::memmove(keys + pos + 1, keys + pos, node->count - pos);
+                    std::memmove(children + pos + 1, children + pos, (node->count - pos) * sizeof(m_Node*));
+                    keys[pos] = byte;
+                    children[pos] = child;
+                    break;
+                }
+                case m_Kind::node48: {
+                    m_Node48* n = static_cast<m_Node48*>(node);
+                    uint8_t slot = 0;
+                    while(n->children[slot]) ++slot;
+                    n->children[slot] = child;
+                    n->index[byte] = slot + 1;
+                    break;
+                }
+                default: static_cast<m_Node256*>(node)->children[byte] = child; break;
+            }
+            ++node->count;
+        }
+
+        static void take_child(m_Inner* node, uint8_t byte) noexcept {
+            switch(node->kind) {
+                case m_Kind::node4:
+                case m_Kind::node16: {
+                    uint8_t* keys = node->kind == m_Kind::node4 ? static_cast<m_Node4*>(node)->keys : static_cast<m_Node16*>(node)->keys;
+                    m_Node** children = node->kind == m_Kind::node4 ? static_cast<m_Node4*>(node)->children : static_cast<m_Node16*>(node)->children;
+                    uint16_t pos = 0;
+                    while(keys[pos] != byte) ++pos;
+                    std::memmove(keys + pos, keys + pos + 1, node->count - pos - 1);
+                    std::memmove(children + pos, children + pos + 1, (node->count - pos - 1) * sizeof(m_Node*));
+                    break;
+                }
+                case m_Kind::node48: {
+                    m_Node48* n = static_cast<m_Node48*>(node);
+                    n->children[n->index[byte] - 1] = nullptr;
+                    n->index[byte] = 0;
+                    break;
+                }
+                default: static_cast<m_Node256*>(node)->children[byte] = nullptr; break;
+            }
+            --node->count;
+        }
+
+        static void set_terminal(m_Inner* node, m_Leaf* leaf) noexcept {
+            node->terminal = leaf;
+            leaf->parent = node;
+            leaf->edge = -1;
+        }
+
+        // Puts replacement where node hangs in the tree.
+        void replace(m_Node* node, m_Node* replacement) noexcept {
+            m_Inner* parent = node->parent;
+            replacement->parent = parent;
+            replacement->edge = node->edge;
+            if(parent == nullptr) {
+                m_root = replacement;
+            } else if(node->edge < 0) {
+                parent->terminal = as_leaf(replacement);
+            } else {
+                *find_child(parent, static_cast<uint8_t>(node->edge)) = replacement;
+            }
+        }
+
+        // Moves the contents of node into a fresh node of another layout and swaps it in.
+        m_Inner* relayout(m_Inner* node, m_Kind kind) {
+            m_Inner* fresh = make_inner(kind);
+            fresh->prefix = std::move(node->prefix);
+            if(node->terminal) set_terminal(fresh, node->terminal);
+            for(m_Node* child = next_child(node, 0); child; child = next_child(node, child->edge + 1)) {
+                put_child(fresh, static_cast<uint8_t>(child->edge), child);
+            }
+            replace(node, fresh);
+            delete_node(node);
+            return fresh;
+        }
+
+        void add_child(m_Inner* node, uint8_t byte, m_Node* child) {
+            if(node->count == capacity_of(node->kind)) {
+                node = relayout(node, node->kind == m_Kind::node4 ? m_Kind::node16 : node->kind == m_Kind::node16 ? m_Kind::node48 : m_Kind::node256);
+            }
+            put_child(node, byte, child);
+        }
+
+        // Restores the invariants after node lost an entry: a node with a single entry is replaced
+        // by it (merging prefixes), and sparse nodes move to a smaller layout.
+        void compact(m_Inner* node) {
+            if(node->count + (node->terminal ? 1 : 0) == 1) {
+                m_Node* only = node->terminal ? static_cast<m_Node*>(node->terminal) : next_child(node, 0);
+                if(!is_leaf(only)) {
+                    m_Inner* inner = as_inner(only);
+                    inner->prefix = node->prefix + static_cast<char>(only->edge) + inner->prefix;
+                }
+                replace(node, only);
+                delete_node(node);
+            } else if(node->kind == m_Kind::node256 && node->count <= 37) {
+                relayout(node, m_Kind::node48);
+            } else if(node->kind == m_Kind::node48 && node->count <= 12) {
+                relayout(node, m_Kind::node16);
+            } else if(node->kind == m_Kind::node16 && node->count <= 3) {
+                relayout(node, m_Kind::node4);
+            }
+        }
+
+        // Places leaf (whose key is key) into the fresh node that splits at depth.
+        static void attach(m_Inner* node, m_Leaf* leaf, std::string_view key, size_type depth) noexcept {
+            if(depth == key.size()) {
+                set_terminal(node, leaf);
+            } else {
+                put_child(node, byte_at(key, depth), leaf);
+            }
+        }
+
+        // Node4 that will split a path at prefix. The new leaf is allocated before it, so the tree is
+        // only changed once both exist; the leaf is freed if the fork cannot be built.
+        static m_Inner* make_fork(m_Leaf* leaf, std::string_view prefix) {
+            m_Inner* fork = nullptr;
+            try {
+                fork = make_inner(m_Kind::node4);
+                fork->prefix.assign(prefix);
+            } catch(...) {
+                if(fork) delete_node(fork);
+                delete leaf;
+                throw;
+            }
+            return fork;
+        }
+
+        template <typename... Args>
+        std::pair<m_Leaf*, bool> insert_leaf(std::string_view key, Args&&... args) {
+            if(m_root == nullptr) {
+                m_root = new m_Leaf(std::forward<Args>(args)...);
+                ++m_size;
+                return {as_leaf(m_root), true};
+            }
+
+            m_Node* node = m_root;
+            size_type depth = 0;
+            while(true) {
+                if(is_leaf(node)) {
+                    m_Leaf* existing = as_leaf(node);
+                    std::string_view other = existing->item.first;
+                    if(other == key) return {existing, false};
+
+                    size_type split = depth;
+                    while(split < other.size() && split < key.size() && other[split] == key[split]) ++split;
+                    m_Leaf* leaf = new m_Leaf(std::forward<Args>(args)...);
+                    m_Inner* fork = make_fork(leaf, key.substr(depth, split - depth));
+                    replace(existing, fork);
+                    attach(fork, existing, other, split);
+                    attach(fork, leaf, key, split);
+                    ++m_size;
+                    return {leaf, true};
+                }
+
+                m_Inner* inner = as_inner(node);
+                const std::string& prefix = inner->prefix;
+                size_type matched = 0;
+                while(matched < prefix.size() && depth + matched < key.size() && prefix[matched] == key[depth + matched]) ++matched;
+
+                if(matched < prefix.size()) {
+                    m_Leaf* leaf = new m_Leaf(std::forward<Args>(args)...);
+                    m_Inner* fork = make_fork(leaf, std::string_view(prefix).substr(0, matched));
+                    replace(inner, fork);
+                    uint8_t byte = static_cast<uint8_t>(prefix[matched]);
+                    inner->prefix.erase(0, matched + 1);
+                    put_child(fork, byte, inner);
+                    attach(fork, leaf, key, depth + matched);
+                    ++m_size;
+                    return {leaf, true};
+                }
+
+                depth += prefix.size();
+                if(depth == key.size()) {
+                    if(inner->terminal) return {inner->terminal, false};
+                    m_Leaf* leaf = new m_Leaf(std::forward<Args>(args)...);
+                    set_terminal(inner, leaf);
+                    ++m_size;
+                    return {leaf, true};
+                }
+
+                m_Node** slot = find_child(inner, byte_at(key, depth));
+                if(slot == nullptr) {
+                    m_Leaf* leaf = new m_Leaf(std::forward<Args>(args)...);
+                    add_child(inner, byte_at(key, depth), leaf);
+                    ++m_size;
+                    return {leaf, true};
+                }
+                node = *slot;
+                ++depth;
+            }
+        }
+
+        m_Leaf* find_leaf(std::string_view key) const noexcept {
+            m_Node* node = m_root;
+            size_type depth = 0;
+            while(node) {
+                if(is_leaf(node)) return std::string_view(as_leaf(node)->item.first) == key ? as_leaf(node) : nullptr;
+                m_Inner* inner = as_inner(node);
+                const std::string& prefix = inner->prefix;
+                if(key.size() < depth + prefix.size() || key.compare(depth, prefix.size(), prefix) != 0) return nullptr;
+                depth += prefix.size();
+                if(depth == key.size()) return inner->terminal;
+                m_Node** slot = find_child(inner, byte_at(key, depth));
+                node = slot ? *slot : nullptr;
+                ++depth;
+            }
+            return nullptr;
+        }
+
+        static m_Leaf* minimum(m_Node* node) noexcept {
+            while(!is_leaf(node)) {
+                m_Inner* inner = as_inner(node);
+                if(inner->terminal) return inner->terminal;
+                node = next_child(inner, 0);
+            }
+            return as_leaf(node);
+        }
+
+        static m_Leaf* maximum(m_Node* node) noexcept {
+            while(!is_leaf(node)) {
+                m_Inner* inner = as_inner(node);
+                m_Node* last = prev_child(inner, 255);
+                if(last == nullptr) return inner->terminal;
+                node = last;
+            }
+            return as_leaf(node);
+        }
+
+        // First leaf after the whole subtree of node.
+        static m_Leaf* next_after(const m_Node* node) noexcept {
+            for(; node->parent; node = node->parent) {
+                m_Node* sibling = next_child(node->parent, node->edge + 1);
+                if(sibling) return minimum(sibling);
+            }
+            return nullptr;
+        }
+
+        // Last leaf before the whole subtree of node.
+        static m_Leaf* prev_before(const m_Node* node) noexcept {
+            for(; node->parent; node = node->parent) {
+                if(node->edge < 0) continue;
+                m_Node* sibling = prev_child(node->parent, node->edge - 1);
+                if(sibling) return maximum(sibling);
+                if(node->parent->terminal) return node->parent->terminal;
+            }
+            return nullptr;
+        }
+
+        // First leaf whose key is not less than key.
+        m_Leaf* seek(std::string_view key) const noexcept {
+            m_Node* node = m_root;
+            size_type depth = 0;
+            while(node) {
+                if(is_leaf(node)) {
+                    m_Leaf* leaf = as_leaf(node);
+                    return std::string_view(leaf->item.first) >= key ? leaf : next_after(leaf);
+                }
+                m_Inner* inner = as_inner(node);
+                const std::string& prefix = inner->prefix;
+                for(size_type i = 0; i < prefix.size(); ++i, ++depth) {
+                    if(depth == key.size()) return minimum(inner);
+                    uint8_t have = static_cast<uint8_t>(prefix[i]);
+                    uint8_t want = byte_at(key, depth);
+                    if(have < want) return next_after(inner);
+                    if(have > want) return minimum(inner);
+                }
+                if(depth == key.size()) return minimum(inner);
+                uint8_t want = byte_at(key, depth);
+                m_Node** slot = find_child(inner, want);
+                if(slot == nullptr) {
+                    m_Node* bigger = next_child(inner, want + 1);
+                    return bigger ? minimum(bigger) : next_after(inner);
+                }
+                node = *slot;
+                ++depth;
+            }
+            return nullptr;
+        }
+
+        void erase_leaf(m_Leaf* leaf) {
+            m_Inner* parent = leaf->parent;
+            if(parent == nullptr) {
+                m_root = nullptr;
+            } else if(leaf->edge < 0) {
+                parent->terminal = nullptr;
+            } else {
+                take_child(parent, static_cast<uint8_t>(leaf->edge));
+            }
+            delete_node(leaf);
+            --m_size;
+            if(parent) compact(parent);
+        }
+
+        static void destroy(m_Node* node) noexcept {
+            if(node == nullptr) return;
+            if(!is_leaf(node)) {
+                m_Inner* inner = as_inner(node);
+                destroy(inner->terminal);
+                for(m_Node* child = next_child(inner, 0); child;) {
+                    int after = child->edge + 1;
+                    destroy(child);
+                    child = next_child(inner, after);
+                }
+            }
+            delete_node(node);
+        }
+
+    public:
+        class ArtIterator {
+            friend class art_map;
+
+        private:
+            m_Leaf* m_leaf;
+            const art_map* m_map;
+
+            ArtIterator(m_Leaf* leaf, const art_map* map) : m_leaf(leaf), m_map(map) {}
+
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = art_map::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = value_type*;
+            using reference = value_type&;
+
+            ArtIterator() : m_leaf(nullptr), m_map(nullptr) {}
+
+            reference operator*() const { return m_leaf->item; }
+
+            pointer operator->() const { return &m_leaf->item; }
+
+            ArtIterator& operator++() {
+                m_leaf = next_after(m_leaf);
+                return *this;
+            }
+
+            ArtIterator operator++(int) {
+                ArtIterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            ArtIterator& operator--() {
+                m_leaf = m_leaf ? prev_before(m_leaf) : (m_map->m_root ? maximum(m_map->m_root) : nullptr);
+                return *this;
+            }
+
+            ArtIterator operator--(int) {
+                ArtIterator tmp = *this;
+                --(*this);
+                return tmp;
+            }
+
+            bool operator==(const ArtIterator& other) const { return m_leaf == other.m_leaf; }
+
+            bool operator!=(const ArtIterator& other) const { return m_leaf != other.m_leaf; }
+        };
+
+        using iterator = ArtIterator;
+        using const_iterator = ArtIterator;
+
+        art_map() : m_root(nullptr), m_size(0) {}
+
+        explicit art_map(std::initializer_list<value_type> const& list) : art_map() {
+            for(const auto& value : list) insert(value);
+        }
+
+        art_map(const art_map& other) : art_map() {
+            for(const auto& value : other) insert(value);
+        }
+
+        art_map(art_map&& other) noexcept : art_map() { swap(other); }
+
+        art_map& operator=(const art_map& other) {
+            if(this != &other) {
+                art_map tmp(other);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        art_map& operator=(art_map&& other) noexcept {
+            if(this != &other) {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        ~art_map() { destroy(m_root); }
+
+        bool operator==(const art_map& other) const {
+            if(m_size != other.m_size) return false;
+            for(iterator a = begin(), b = other.begin(); a != end(); ++a, ++b) {
+                if(!(*a == *b)) return false;
+            }
+            return true;
+        }
+
+        mapped_type& operator[](const key_type& key) { return insert_leaf(key, key, mapped_type()).first->item.second; }
+
+        mapped_type& at(std::string_view key) const {
+            m_Leaf* leaf = find_leaf(key);
+            if(leaf == nullptr) throw std::out_of_range("Key not found");
+            return leaf->item.second;
+        }
+
+        iterator begin() const { return iterator(m_root ? minimum(m_root) : nullptr, this); }
+        iterator end() const { return iterator(nullptr, this); }
+        bool empty() const { return m_size == 0; }
+        size_type size() const { return m_size; }
+        size_type max_size() const { return std::numeric_limits<size_type>::max() / sizeof(m_Leaf); }
+
+        void clear() {
+            destroy(m_root);
+            m_root = nullptr;
+            m_size = 0;
+        }
+
+        std::pair<iterator, bool> insert(const value_type& value) {
+            std::pair<m_Leaf*, bool> res = insert_leaf(value.first, value);
+            return {iterator(res.first, this), res.second};
+        }
+
+        std::pair<iterator, bool> insert(const key_type& key, const mapped_type& obj) {
+            std::pair<m_Leaf*, bool> res = insert_leaf(key, key, obj);
+            return {iterator(res.first, this), res.second};
+        }
+
+        // cppcheck-suppress unusedFunction
+        std::pair<iterator, bool> insert_or_assign(const key_type& key, const mapped_type& obj) {
+            std::pair<m_Leaf*, bool> res = insert_leaf(key, key, obj);
+            if(!res.second) res.first->item.second = obj;
+            return {iterator(res.first, this), res.second};
+        }
+
+        // cppcheck-suppress passedByValue
+        void erase(iterator pos) {
+            if(pos.m_leaf) erase_leaf(pos.m_leaf);
+        }
+
+        size_type erase(std::string_view key) {
+            m_Leaf* leaf = find_leaf(key);
+            if(leaf == nullptr) return 0;
+            erase_leaf(leaf);
+            return 1;
+        }
+
+        void swap(art_map& other) noexcept {
+            std::swap(m_root, other.m_root);
+            std::swap(m_size, other.m_size);
+        }
+
+        void merge(art_map& other) {
+            if(this == &other) return;
+            for(const auto& value : other) insert(value);
+            other.clear();
+        }
+
+        iterator find(std::string_view key) const { return iterator(find_leaf(key), this); }
+        bool contains(std::string_view key) const { return find_leaf(key) != nullptr; }
+        size_type count(std::string_view key) const { return contains(key) ? 1 : 0; }
+
+        iterator lower_bound(std::string_view key) const { return iterator(seek(key), this); }
+
+        iterator upper_bound(std::string_view key) const {
+            m_Leaf* leaf = seek(key);
+            if(leaf && std::string_view(leaf->item.first) == key) leaf = next_after(leaf);
+            return iterator(leaf, this);
+        }
+
+        // Range of all keys starting with prefix.
+        std::pair<iterator, iterator> prefix_range(std::string_view prefix) const {
+            std::string bound(prefix);
+            while(!bound.empty() && static_cast<uint8_t>(bound.back()) == 0xFF) bound.pop_back();
+            if(bound.empty()) return {lower_bound(prefix), end()};
+            bound.back() = static_cast<char>(static_cast<uint8_t>(bound.back()) + 1);
+            return {lower_bound(prefix), lower_bound(bound)};
+        }
+
+        template <typename... Args>
+        s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+            s21::vector<std::pair<iterator, bool>> result;
+            result.reserve(sizeof...(args));
+            (result.push_back(insert(std::forward<Args>(args))), ...);
+            return result;
+        }
+    };
+} // namespace s21
+#endif
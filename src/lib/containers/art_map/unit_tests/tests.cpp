@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "./../s21_art_map.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+namespace {
+    template <typename Expected>
+    void expect_same(const art_map<int>& m, const Expected& expected) {
+        ASSERT_EQ(m.size(), expected.size());
+        auto it = m.begin();
+        for(const auto& item : expected) {
+            ASSERT_EQ(it->first, item.first);
+            ASSERT_EQ(it->second, item.second);
+            ++it;
+        }
+        EXPECT_TRUE(it == m.end());
+    }
+
+    // Value whose copy throws while armed.
+    struct ThrowingValue {
+        static inline bool armed = false;
+        int value;
+
+        explicit ThrowingValue(int v) : value(v) {}
+
+        ThrowingValue(const ThrowingValue& other) : value(other.value) {
+            if(armed) throw std::runtime_error("copy");
+        }
+    };
+} // namespace
+
+TEST(artMapTest, DefaultConstructor) {
+    art_map<int> m;
+    EXPECT_TRUE(m.empty());
+    EXPECT_EQ(m.size(), (size_t) 0);
+    EXPECT_TRUE(m.begin() == m.end());
+}
+
+TEST(artMapTest, ListConstructorOrdersKeys) {
+    art_map<int> m{{"banana", 2}, {"apple", 1}, {"cherry", 3}, {"apple", 9}};
+    std::map<std::string, int> expected{{"apple", 1}, {"banana", 2}, {"cherry", 3}};
+    expect_same(m, expected);
+}
+
+TEST(artMapTest, KeysThatArePrefixesOfOthers) {
+    art_map<int> m;
+    std::map<std::string, int> expected;
+    const char* keys[] = {"abc", "", "a", "abcd", "ab", "abd", "b", "abcde"};
+    int value = 0;
+    for(const char* key : keys) {
+        EXPECT_TRUE(m.insert(key, value).second);
+        expected[key] = value++;
+    }
+    expect_same(m, expected);
+    for(const auto& item : expected) EXPECT_EQ(m.at(item.first), item.second);
+    EXPECT_FALSE(m.contains("abcdef"));
+    EXPECT_FALSE(m.contains("ac"));
+}
+
+TEST(artMapTest, AtAndSquareBrackets) {
+    art_map<int> m{{"one", 1}};
+    EXPECT_THROW(m.at("two"), std::out_of_range);
+    ++m["two"];
+    ++m["two"];
+    EXPECT_EQ(m.at("two"), 2);
+    EXPECT_EQ(m["three"], 0);
+    EXPECT_EQ(m.size(), (size_t) 3);
+}
+
+TEST(artMapTest, InsertOrAssign) {
+    art_map<int> m;
+    EXPECT_TRUE(m.insert_or_assign("key", 1).second);
+    EXPECT_FALSE(m.insert_or_assign("key", 2).second);
+    EXPECT_EQ(m.at("key"), 2);
+    EXPECT_FALSE(m.insert("key", 3).second);
+    EXPECT_EQ(m.at("key"), 2);
+}
+
+TEST(artMapTest, RandomizedAgainstStdMap) {
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> length(0, 6);
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::uniform_int_distribution<int> narrow('a', 'c');
+    art_map<int> m;
+    std::map<std::string, int> expected;
+    for(int i = 0; i < 20000; ++i) {
+        std::string key;
+        int len = length(gen);
+        for(int j = 0; j < len; ++j) key += static_cast<char>(i % 3 ? narrow(gen) : byte(gen));
+        if(i % 4 == 3) {
+            EXPECT_EQ(m.erase(key), expected.erase(key));
+        } else {
+            EXPECT_EQ(m.insert(key, i).second, expected.emplace(key, i).second);
+        }
+    }
+    expect_same(m, expected);
+
+    std::vector<std::string> probes{"", "a", "b", "ab", "abc", "ca", "zz", "\xff", "\x80\x01"};
+    for(const std::string& probe : probes) {
+        auto it = m.lower_bound(probe);
+        auto want = expected.lower_bound(probe);
+        EXPECT_EQ(it == m.end(), want == expected.end());
+        if(want != expected.end()) {
+            EXPECT_EQ(it->first, want->first);
+        }
+        auto up = m.upper_bound(probe);
+        auto want_up = expected.upper_bound(probe);
+        EXPECT_EQ(up == m.end(), want_up == expected.end());
+        if(want_up != expected.end()) {
+            EXPECT_EQ(up->first, want_up->first);
+        }
+    }
+
+    for(const auto& item : expected) ASSERT_EQ(m.erase(item.first), (size_t) 1);
+    EXPECT_TRUE(m.empty());
+    EXPECT_TRUE(m.begin() == m.end());
+}
+
+TEST(artMapTest, WideFanoutGrowsAndShrinks) {
+    art_map<int> m;
+    std::map<std::string, int> expected;
+    for(int byte = 255; byte >= 0; --byte) {
+        std::string key = "node/" + std::string(1, static_cast<char>(byte));
+        m.insert(key, byte);
+        expected[key] = byte;
+    }
+    expect_same(m, expected);
+    for(int byte = 0; byte < 256; byte += 2) {
+        std::string key = "node/" + std::string(1, static_cast<char>(byte));
+        m.erase(key);
+        expected.erase(key);
+        if(byte % 32 == 0) expect_same(m, expected);
+    }
+    expect_same(m, expected);
+}
+
+TEST(artMapTest, BidirectionalIteration) {
+    art_map<int> m{{"a", 1}, {"ab", 2}, {"abc", 3}, {"b", 4}, {"ba", 5}};
+    std::vector<std::string> backwards;
+    auto it = m.end();
+    while(it != m.begin()) backwards.push_back((--it)->first);
+    EXPECT_EQ(backwards, (std::vector<std::string>{"ba", "b", "abc", "ab", "a"}));
+    it = m.find("abc");
+    EXPECT_EQ((it++)->second, 3);
+    EXPECT_EQ(it->second, 4);
+    EXPECT_EQ((--it)->first, "abc");
+}
+
+TEST(artMapTest, PrefixRange) {
+    art_map<int> m{{"/api/users", 1}, {"/api/users/7", 2}, {"/api/user", 3}, {"/api/v2", 4}, {"/static", 5}, {"\xff\xff", 6}, {"\xff\xff\x01", 7}};
+    auto range = m.prefix_range("/api/users");
+    std::vector<int> values;
+    for(auto it = range.first; it != range.second; ++it) values.push_back(it->second);
+    EXPECT_EQ(values, (std::vector<int>{1, 2}));
+
+    range = m.prefix_range("/api/");
+    size_t count = 0;
+    for(auto it = range.first; it != range.second; ++it) ++count;
+    EXPECT_EQ(count, (size_t) 4);
+
+    range = m.prefix_range("\xff\xff");
+    EXPECT_EQ(range.first->second, 6);
+    EXPECT_TRUE(range.second == m.end());
+
+    range = m.prefix_range("/nothing");
+    EXPECT_TRUE(range.first == range.second);
+}
+
+TEST(artMapTest, CopyMoveSwapMerge) {
+    art_map<int> a{{"x", 1}, {"xy", 2}};
+    art_map<int> b(a);
+    EXPECT_TRUE(a == b);
+    b["z"] = 3;
+    EXPECT_FALSE(a == b);
+    art_map<int> c(std::move(b));
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(c.size(), (size_t) 3);
+    a.swap(c);
+    EXPECT_EQ(a.size(), (size_t) 3);
+    art_map<int> d{{"w", 0}, {"x", 9}};
+    d.merge(a);
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(d.size(), (size_t) 4);
+    EXPECT_EQ(d.at("x"), 9);
+    a = d;
+    EXPECT_TRUE(a == d);
+}
+
+TEST(artMapTest, InsertMany) {
+    art_map<int> m;
+    auto res = m.insert_many(std::pair<const std::string, int>{"a", 1}, std::pair<const std::string, int>{"a", 2});
+    EXPECT_TRUE(res[0].second);
+    EXPECT_FALSE(res[1].second);
+    EXPECT_EQ(m.at("a"), 1);
+}
+
+TEST(artMapTest, ThrowingValueLeavesTreeIntact) {
+    art_map<ThrowingValue> m;
+    ThrowingValue value(1);
+    for(const char* key : {"apple", "apply", "banana"}) m.insert(key, value);
+    ThrowingValue::armed = true;
+    // Splits the "apple" leaf, a path-compressed prefix, and adds to an existing node.
+    EXPECT_THROW(m.insert("bandana", value), std::runtime_error);
+    EXPECT_THROW(m.insert("apricot", value), std::runtime_error);
+    EXPECT_THROW(m.insert("cherry", value), std::runtime_error);
+    ThrowingValue::armed = false;
+    EXPECT_EQ(m.size(), (size_t) 3);
+    std::vector<std::string> keys;
+    for(auto it = m.begin(); it != m.end(); ++it) keys.push_back(it->first);
+    EXPECT_EQ(keys, (std::vector<std::string>{"apple", "apply", "banana"}));
+    EXPECT_FALSE(m.contains("apricot"));
+    EXPECT_TRUE(m.insert("apricot", value).second);
+    EXPECT_TRUE(m.contains("apricot"));
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
@@ -0,0 +1,690 @@
+#ifndef S21_CONTAINERS_BITMAP_SET
+#define S21_CONTAINERS_BITMAP_SET
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "./../vector/s21_vector.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define S21_BITMAP_SET_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define S21_BITMAP_SET_SSE2 1
+#endif
+
+namespace s21 {
+    // Ordered set of unsigned integers in roaring-bitmap layout. Values are split into a high part,
+    // which selects a chunk, and 16 low bits stored inside the chunk in one of three forms:
+    //   array  - sorted uint16_t values, for chunks of at most 4096 elements (2 bytes per value);
+    //   bitmap - 65536 bits in 1024 words, for denser chunks (8 KiB flat);
+    //   run    - sorted (first, last) pairs, chosen by run_optimize() when it is the smallest form.
+    // Chunks switch between array and bitmap on their own as they grow and shrink. Modifying a run
+    // chunk turns it back into an array or a bitmap, so call run_optimize() after bulk updates.
+    //
+    // Union, intersection and difference work chunk by chunk; bitmap pairs are combined with
+    // AVX2 or SSE2 word operations. Iterators yield values, not references.
+    template <typename T = uint32_t>
+    class bitmap_set {
+        static_assert(std::is_unsigned_v<T> && sizeof(T) >= 2, "bitmap_set stores unsigned integers of 16 bits or more");
+
+    public:
+        using key_type = T;
+        using value_type = T;
+        using reference = T;
+        using const_reference = T;
+        using size_type = size_t;
+
+    private:
+        static constexpr uint32_t kNone = 65536;
+        static constexpr uint32_t kArrayMax = 4096;
+        static constexpr size_type kWords = 1024;
+
+        static T high_of(T value) noexcept { return static_cast<T>(value >> 16); }
+        static uint32_t low_of(T value) noexcept { return static_cast<uint32_t>(value & 0xFFFF); }
+
+        enum class m_Op { union_op, intersection_op, difference_op };
+
+        // dst = a op b over kWords words; returns the number of bits set in dst.
+        static uint32_t combine_words(const uint64_t* a, const uint64_t* b, uint64_t* dst, m_Op op) noexcept {
+#if defined(S21_BITMAP_SET_AVX2)
+            for(size_type i = 0; i < kWords; i += 4) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+                __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+                __m256i r = op == m_Op::union_op        ? _mm256_or_si256(x, y)
+                            : op == m_Op::intersection_op ? _mm256_and_si256(x, y)
+                                                          : _mm256_andnot_si256(y, x);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), r);
+            }
+#elif defined(S21_BITMAP_SET_SSE2)
+            for(size_type i = 0; i < kWords; i += 2) {
+                __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+                __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+                __m128i r = op == m_Op::union_op        ? _mm_or_si128(x, y)
+                            : op == m_Op::intersection_op ? _mm_and_si128(x, y)
+                                                          : _mm_andnot_si128(y, x);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), r);
+            }
+#else
+            for(size_type i = 0; i < kWords; ++i) {
+                dst[i] = op == m_Op::union_op ? a[i] | b[i] : op == m_Op::intersection_op ? a[i] & b[i] : a[i] & ~b[i];
+            }
+#endif
+            uint32_t cardinality = 0;
+            for(size_type i = 0; i < kWords; ++i) cardinality += std::popcount(dst[i]);
+            return cardinality;
+        }
+
+        struct m_Chunk {
+            enum kind_type { array_kind, bitmap_kind, run_kind };
+
+            T high;
+            kind_type kind;
+            uint32_t cardinality;
+            s21::vector<uint16_t> values; // array: sorted values; run: (first, last) pairs
+            s21::vector<uint64_t> bits;   // bitmap: kWords words
+
+            m_Chunk() : high(0), kind(array_kind), cardinality(0) {}
+
+            explicit m_Chunk(T chunk_high) : high(chunk_high), kind(array_kind), cardinality(0) {}
+
+            m_Chunk(const m_Chunk& other) = default;
+            m_Chunk(m_Chunk&& other) noexcept = default;
+
+            m_Chunk& operator=(const m_Chunk& other) {
+                if(this != &other) {
+                    m_Chunk tmp(other);
+                    swap(tmp);
+                }
+                return *this;
+            }
+
+            m_Chunk& operator=(m_Chunk&& other) noexcept = default;
+
+            void swap(m_Chunk& other) noexcept {
+                std::swap(high, other.high);
+                std::swap(kind, other.kind);
+                std::swap(cardinality, other.cardinality);
+                values.swap(other.values);
+                bits.swap(other.bits);
+            }
+
+            const uint16_t* array() const noexcept { return values.data(); }
+            const uint64_t* words() const noexcept { return bits.data(); }
+
+            size_type runs() const noexcept { return values.size() / 2; }
+            uint32_t run_first(size_type run) const noexcept { return values.data()[2 * run]; }
+            uint32_t run_last(size_type run) const noexcept { return values.data()[2 * run + 1]; }
+
+            bool test(uint32_t low) const noexcept { return (words()[low >> 6] >> (low & 63)) & 1; }
+
+            // First set bit at or after low, or kNone.
+            uint32_t next_bit(uint32_t low) const noexcept {
+                if(low >= kNone) return kNone;
+                size_type word = low >> 6;
+                uint64_t bits_left = words()[word] & (~0ull << (low & 63));
+                while(bits_left == 0) {
+                    if(++word == kWords) return kNone;
+                    bits_left = words()[word];
+                }
+                return static_cast<uint32_t>(word * 64 + std::countr_zero(bits_left));
+            }
+
+            // Last set bit at or before low, or kNone.
+            uint32_t prev_bit(uint32_t low) const noexcept {
+                size_type word = low >> 6;
+                uint64_t bits_left = words()[word] & (~0ull >> (63 - (low & 63)));
+                while(bits_left == 0) {
+                    if(word-- == 0) return kNone;
+                    bits_left = words()[word];
+                }
+                return static_cast<uint32_t>(word * 64 + 63 - std::countl_zero(bits_left));
+            }
+
+            // Index of the last run starting at or before low, or runs() when there is none.
+            size_type find_run(uint32_t low) const noexcept {
+                size_type lo = 0;
+                size_type hi = runs();
+                while(lo < hi) {
+                    size_type mid = (lo + hi) / 2;
+                    if(run_first(mid) <= low) {
+                        lo = mid + 1;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                return lo == 0 ? runs() : lo - 1;
+            }
+
+            bool contains(uint32_t low) const noexcept {
+                if(kind == array_kind) return std::binary_search(array(), array() + cardinality, static_cast<uint16_t>(low));
+                if(kind == bitmap_kind) return test(low);
+                size_type run = find_run(low);
+                return run != runs() && low <= run_last(run);
+            }
+
+            // First element >= low, or kNone; pos receives the array index or run index.
+            uint32_t seek(uint32_t low, size_type& pos) const noexcept {
+                if(kind == array_kind) {
+                    pos = std::lower_bound(array(), array() + cardinality, low) - array();
+                    return pos < cardinality ? array()[pos] : kNone;
+                }
+                if(kind == bitmap_kind) return next_bit(low);
+                size_type run = find_run(low);
+                if(run != runs() && low <= run_last(run)) {
+                    pos = run;
+                    return low;
+                }
+                pos = run == runs() ? 0 : run + 1;
+                return pos < runs() ? run_first(pos) : kNone;
+            }
+
+            // Last element <= low, or kNone.
+            uint32_t seek_back(uint32_t low, size_type& pos) const noexcept {
+                if(kind == array_kind) {
+                    pos = std::upper_bound(array(), array() + cardinality, low) - array();
+                    if(pos == 0) return kNone;
+                    return array()[--pos];
+                }
+                if(kind == bitmap_kind) return prev_bit(low);
+                pos = find_run(low);
+                if(pos == runs()) return kNone;
+                return std::min(low, run_last(pos));
+            }
+
+            uint32_t next(uint32_t low, size_type& pos) const noexcept {
+                if(kind == array_kind) return ++pos < cardinality ? array()[pos] : kNone;
+                if(kind == bitmap_kind) return next_bit(low + 1);
+                if(low < run_last(pos)) return low + 1;
+                return ++pos < runs() ? run_first(pos) : kNone;
+            }
+
+            uint32_t prev(uint32_t low, size_type& pos) const noexcept {
+                if(kind == array_kind) return pos == 0 ? kNone : array()[--pos];
+                if(kind == bitmap_kind) return low == 0 ? kNone : prev_bit(low - 1);
+                if(low > run_first(pos)) return low - 1;
+                return pos == 0 ? kNone : run_last(--pos);
+            }
+
+            // Number of elements <= low.
+            size_type rank(uint32_t low) const noexcept {
+                if(kind == array_kind) return std::upper_bound(array(), array() + cardinality, low) - array();
+                size_type result = 0;
+                if(kind == bitmap_kind) {
+                    size_type word = low >> 6;
+                    for(size_type i = 0; i < word; ++i) result += std::popcount(words()[i]);
+                    return result + std::popcount(words()[word] & (~0ull >> (63 - (low & 63))));
+                }
+                for(size_type run = 0; run < runs() && run_first(run) <= low; ++run) {
+                    result += std::min(low, run_last(run)) - run_first(run) + 1;
+                }
+                return result;
+            }
+
+            // The n-th smallest element, n < cardinality.
+            uint32_t select(size_type n) const noexcept {
+                if(kind == array_kind) return array()[n];
+                if(kind == bitmap_kind) {
+                    size_type word = 0;
+                    for(size_type count = std::popcount(words()[0]); count <= n; count = std::popcount(words()[++word])) {
+                        n -= count;
+                    }
+                    uint64_t w = words()[word];
+                    for(; n > 0; --n) w &= w - 1;
+                    return static_cast<uint32_t>(word * 64 + std::countr_zero(w));
+                }
+                size_type run = 0;
+                for(; run_last(run) - run_first(run) + 1 <= n; ++run) n -= run_last(run) - run_first(run) + 1;
+                return static_cast<uint32_t>(run_first(run) + n);
+            }
+
+            template <typename Fn>
+            void for_each(Fn fn) const {
+                if(kind == array_kind) {
+                    for(size_type i = 0; i < cardinality; ++i) fn(array()[i]);
+                } else if(kind == bitmap_kind) {
+                    for(size_type word = 0; word < kWords; ++word) {
+                        for(uint64_t w = words()[word]; w; w &= w - 1) fn(static_cast<uint32_t>(word * 64 + std::countr_zero(w)));
+                    }
+                } else {
+                    for(size_type run = 0; run < runs(); ++run) {
+                        for(uint32_t low = run_first(run); low <= run_last(run); ++low) fn(low);
+                    }
+                }
+            }
+
+            void to_bitmap() {
+                if(kind == bitmap_kind) return;
+                s21::vector<uint64_t> new_bits(kWords);
+                uint64_t* dst = new_bits.data();
+                for_each([dst](uint32_t low) { dst[low >> 6] |= 1ull << (low & 63); });
+                bits.swap(new_bits);
+                values = s21::vector<uint16_t>();
+                kind = bitmap_kind;
+            }
+
+            void to_array() {
+                if(kind == array_kind) return;
+                s21::vector<uint16_t> new_values;
+                new_values.reserve(cardinality);
+                for_each([&new_values](uint32_t low) { new_values.push_back(static_cast<uint16_t>(low)); });
+                values.swap(new_values);
+                bits = s21::vector<uint64_t>();
+                kind = array_kind;
+            }
+
+            // Picks array or bitmap by cardinality; used after bulk operations and on run chunks
+            // that are about to be modified.
+            void normalize() {
+                if(cardinality <= kArrayMax) {
+                    to_array();
+                } else {
+                    to_bitmap();
+                }
+            }
+
+            size_type count_runs() const noexcept {
+                if(kind == run_kind) return runs();
+                size_type result = 0;
+                if(kind == array_kind) {
+                    for(size_type i = 0; i < cardinality; ++i) result += i == 0 || array()[i] != array()[i - 1] + 1;
+                    return result;
+                }
+                uint64_t carry = 0;
+                for(size_type word = 0; word < kWords; ++word) {
+                    uint64_t w = words()[word];
+                    result += std::popcount(w & ~((w << 1) | carry));
+                    carry = w >> 63;
+                }
+                return result;
+            }
+
+            size_type bytes() const noexcept {
+                if(kind == bitmap_kind) return kWords * sizeof(uint64_t);
+                return values.size() * sizeof(uint16_t);
+            }
+
+            // Switches to run form when that is the smallest of the three.
+            void optimize() {
+                size_type run_bytes = count_runs() * 2 * sizeof(uint16_t);
+                size_type other_bytes = cardinality <= kArrayMax ? cardinality * sizeof(uint16_t) : kWords * sizeof(uint64_t);
+                if(run_bytes >= other_bytes) {
+                    normalize();
+                    return;
+                }
+                if(kind == run_kind) return;
+                s21::vector<uint16_t> new_values;
+                new_values.reserve(run_bytes / sizeof(uint16_t));
+                uint32_t first = kNone;
+                uint32_t last = kNone;
+                for_each([&](uint32_t low) {
+                    if(first != kNone && low == last + 1) {
+                        last = low;
+                        return;
+                    }
+                    if(first != kNone) {
+                        new_values.push_back(static_cast<uint16_t>(first));
+                        new_values.push_back(static_cast<uint16_t>(last));
+                    }
+                    first = last = low;
+                });
+                new_values.push_back(static_cast<uint16_t>(first));
+                new_values.push_back(static_cast<uint16_t>(last));
+                values.swap(new_values);
+                bits = s21::vector<uint64_t>();
+                kind = run_kind;
+            }
+
+            bool insert(uint32_t low) {
+                if(kind == run_kind) {
+                    if(contains(low)) return false;
+                    normalize();
+                }
+                if(kind == array_kind) {
+                    uint16_t* pos = std::lower_bound(values.begin(), values.end(), low);
+                    if(pos != values.end() && *pos == low) return false;
+                    if(cardinality < kArrayMax) {
+                        values.insert(pos, static_cast<uint16_t>(low));
+                        ++cardinality;
+                        return true;
+                    }
+                    to_bitmap();
+                }
+                if(test(low)) return false;
+                bits.data()[low >> 6] |= 1ull << (low & 63);
+                ++cardinality;
+                return true;
+            }
+
+            bool erase(uint32_t low) {
+                if(!contains(low)) return false;
+                if(kind == run_kind) normalize();
+                if(kind == array_kind) {
+                    values.erase(std::lower_bound(values.begin(), values.end(), low));
+                } else {
+                    bits.data()[low >> 6] &= ~(1ull << (low & 63));
+                }
+                if(--cardinality == kArrayMax) to_array();
+                return true;
+            }
+
+            static m_Chunk combine(const m_Chunk& left, const m_Chunk& right, m_Op op) {
+                m_Chunk a(left);
+                m_Chunk b(right);
+                if(a.kind == run_kind) a.normalize();
+                if(b.kind == run_kind) b.normalize();
+
+                m_Chunk result(a.high);
+                if(a.kind == array_kind && b.kind == array_kind &&
+                   (op != m_Op::union_op || a.cardinality + b.cardinality <= kArrayMax)) {
+                    auto out = std::back_inserter(result.values);
+                    const uint16_t* a_end = a.array() + a.cardinality;
+                    const uint16_t* b_end = b.array() + b.cardinality;
+                    if(op == m_Op::union_op) {
+                        std::set_union(a.array(), a_end, b.array(), b_end, out);
+                    } else if(op == m_Op::intersection_op) {
+                        std::set_intersection(a.array(), a_end, b.array(), b_end, out);
+                    } else {
+                        std::set_difference(a.array(), a_end, b.array(), b_end, out);
+                    }
+                    result.cardinality = static_cast<uint32_t>(result.values.size());
+                    return result;
+                }
+
+                if(a.kind == array_kind && op != m_Op::union_op) {
+                    // Probing the bitmap is cheaper than materialising the array as one.
+                    for(size_type i = 0; i < a.cardinality; ++i) {
+                        if(b.test(a.array()[i]) == (op == m_Op::intersection_op)) result.values.push_back(a.array()[i]);
+                    }
+                    result.cardinality = static_cast<uint32_t>(result.values.size());
+                    return result;
+                }
+
+                a.to_bitmap();
+                b.to_bitmap();
+                result.bits = s21::vector<uint64_t>(kWords);
+                result.kind = bitmap_kind;
+                result.cardinality = combine_words(a.words(), b.words(), result.bits.data(), op);
+                result.normalize();
+                return result;
+            }
+        };
+
+        s21::vector<m_Chunk> m_chunks;
+        size_type m_size;
+
+        const m_Chunk* chunks() const noexcept { return m_chunks.data(); }
+
+        // Index of the first chunk whose high part is >= high.
+        size_type chunk_index(T high) const noexcept {
+            const m_Chunk* found =
+                std::lower_bound(chunks(), chunks() + m_chunks.size(), high, [](const m_Chunk& chunk, T key) { return chunk.high < key; });
+            return found - chunks();
+        }
+
+        static bitmap_set combine(const bitmap_set& a, const bitmap_set& b, m_Op op) {
+            bitmap_set result;
+            size_type i = 0;
+            size_type j = 0;
+            auto append = [&result](const m_Chunk& chunk) {
+                if(chunk.cardinality == 0) return;
+                result.m_chunks.push_back(chunk);
+                result.m_size += chunk.cardinality;
+            };
+            while(i < a.m_chunks.size() || j < b.m_chunks.size()) {
+                if(j == b.m_chunks.size() || (i < a.m_chunks.size() && a.chunks()[i].high < b.chunks()[j].high)) {
+                    if(op != m_Op::intersection_op) append(a.chunks()[i]);
+                    ++i;
+                } else if(i == a.m_chunks.size() || b.chunks()[j].high < a.chunks()[i].high) {
+                    if(op == m_Op::union_op) append(b.chunks()[j]);
+                    ++j;
+                } else {
+                    append(m_Chunk::combine(a.chunks()[i++], b.chunks()[j++], op));
+                }
+            }
+            return result;
+        }
+
+    public:
+        class BitmapIterator {
+            friend class bitmap_set;
+
+        private:
+            const bitmap_set* m_set;
+            size_type m_chunk;
+            size_type m_pos;
+            uint32_t m_low;
+
+            BitmapIterator(const bitmap_set* set, size_type chunk) : m_set(set), m_chunk(chunk), m_pos(0), m_low(0) {}
+
+            const m_Chunk& chunk() const { return m_set->chunks()[m_chunk]; }
+
+            // Moves to the first element of chunk m_chunk or, if it is past the last, to end().
+            void enter_front() {
+                if(m_chunk < m_set->m_chunks.size()) m_low = chunk().seek(0, m_pos);
+            }
+
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = T;
+
+            BitmapIterator() : m_set(nullptr), m_chunk(0), m_pos(0), m_low(0) {}
+
+            T operator*() const { return static_cast<T>((chunk().high << 16) | m_low); }
+
+            BitmapIterator& operator++() {
+                m_low = chunk().next(m_low, m_pos);
+                if(m_low == kNone) {
+                    ++m_chunk;
+                    m_pos = 0;
+                    m_low = 0;
+                    enter_front();
+                }
+                return *this;
+            }
+
+            BitmapIterator operator++(int) {
+                BitmapIterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            BitmapIterator& operator--() {
+                uint32_t low = m_chunk < m_set->m_chunks.size() ? chunk().prev(m_low, m_pos) : kNone;
+                if(low == kNone) {
+                    --m_chunk;
+                    low = chunk().seek_back(kNone - 1, m_pos);
+                }
+                m_low = low;
+                return *this;
+            }
+
+            BitmapIterator operator--(int) {
+                BitmapIterator tmp = *this;
+                --(*this);
+                return tmp;
+            }
+
+            bool operator==(const BitmapIterator& other) const { return m_chunk == other.m_chunk && m_low == other.m_low; }
+
+            bool operator!=(const BitmapIterator& other) const { return !(*this == other); }
+        };
+
+        using iterator = BitmapIterator;
+        using const_iterator = BitmapIterator;
+
+        bitmap_set() : m_chunks(), m_size(0) {}
+
+        explicit bitmap_set(std::initializer_list<T> const& list) : bitmap_set() {
+            for(T value : list) insert(value);
+        }
+
+        bitmap_set(const bitmap_set& other) : m_chunks(other.m_chunks), m_size(other.m_size) {}
+
+        bitmap_set(bitmap_set&& other) noexcept : m_chunks(std::move(other.m_chunks)), m_size(other.m_size) { other.m_size = 0; }
+
+        bitmap_set& operator=(const bitmap_set& other) {
+            if(this != &other) {
+                bitmap_set tmp(other);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        bitmap_set& operator=(bitmap_set&& other) noexcept {
+            if(this != &other) {
+                m_chunks = std::move(other.m_chunks);
+                m_size = other.m_size;
+                other.m_size = 0;
+            }
+            return *this;
+        }
+
+        ~bitmap_set() = default;
+
+        bool operator==(const bitmap_set& other) const {
+            if(m_size != other.m_size) return false;
+            for(iterator a = begin(), b = other.begin(); a != end(); ++a, ++b) {
+                if(*a != *b) return false;
+            }
+            return true;
+        }
+
+        iterator begin() const {
+            iterator it(this, 0);
+            it.enter_front();
+            return it;
+        }
+
+        iterator end() const { return iterator(this, m_chunks.size()); }
+
+        bool empty() const { return m_size == 0; }
+        size_type size() const { return m_size; }
+        size_type max_size() const { return std::numeric_limits<T>::max(); }
+
+        void clear() {
+            m_chunks = s21::vector<m_Chunk>();
+            m_size = 0;
+        }
+
+        std::pair<iterator, bool> insert(T value) {
+            T high = high_of(value);
+            size_type index = chunk_index(high);
+            if(index == m_chunks.size() || chunks()[index].high != high) m_chunks.insert(m_chunks.begin() + index, m_Chunk(high));
+            bool inserted = m_chunks.data()[index].insert(low_of(value));
+            m_size += inserted;
+            return {find(value), inserted};
+        }
+
+        // cppcheck-suppress passedByValue
+        void erase(iterator pos) {
+            if(pos != end()) erase(*pos);
+        }
+
+        size_type erase(T value) {
+            size_type index = chunk_index(high_of(value));
+            if(index == m_chunks.size() || chunks()[index].high != high_of(value)) return 0;
+            if(!m_chunks.data()[index].erase(low_of(value))) return 0;
+            if(chunks()[index].cardinality == 0) m_chunks.erase(m_chunks.begin() + index);
+            --m_size;
+            return 1;
+        }
+
+        void swap(bitmap_set& other) noexcept {
+            m_chunks.swap(other.m_chunks);
+            std::swap(m_size, other.m_size);
+        }
+
+        void merge(bitmap_set& other) {
+            if(this == &other) return;
+            *this |= other;
+            other.clear();
+        }
+
+        bool contains(T value) const {
+            size_type index = chunk_index(high_of(value));
+            return index != m_chunks.size() && chunks()[index].high == high_of(value) && chunks()[index].contains(low_of(value));
+        }
+
+        size_type count(T value) const { return contains(value) ? 1 : 0; }
+
+        iterator find(T value) const {
+            iterator it = lower_bound(value);
+            return (it != end() && *it == value) ? it : end();
+        }
+
+        iterator lower_bound(T value) const {
+            iterator it(this, chunk_index(high_of(value)));
+            if(it.m_chunk == m_chunks.size()) return it;
+            if(it.chunk().high == high_of(value)) {
+                it.m_low = it.chunk().seek(low_of(value), it.m_pos);
+                if(it.m_low != kNone) return it;
+                ++it.m_chunk;
+                it.m_pos = 0;
+                it.m_low = 0;
+            }
+            it.enter_front();
+            return it;
+        }
+
+        iterator upper_bound(T value) const { return value == std::numeric_limits<T>::max() ? end() : lower_bound(value + 1); }
+
+        // Number of elements not greater than value.
+        size_type rank(T value) const {
+            size_type index = chunk_index(high_of(value));
+            size_type result = 0;
+            for(size_type i = 0; i < index; ++i) result += chunks()[i].cardinality;
+            if(index < m_chunks.size() && chunks()[index].high == high_of(value)) result += chunks()[index].rank(low_of(value));
+            return result;
+        }
+
+        // Iterator to the n-th smallest element (0-based), or end() when n >= size().
+        iterator select(size_type n) const {
+            if(n >= m_size) return end();
+            size_type index = 0;
+            while(n >= chunks()[index].cardinality) n -= chunks()[index++].cardinality;
+            iterator it(this, index);
+            it.m_low = it.chunk().seek(it.chunk().select(n), it.m_pos);
+            return it;
+        }
+
+        // Converts every chunk to its smallest form, including run form for clustered values.
+        void run_optimize() {
+            for(size_type i = 0; i < m_chunks.size(); ++i) m_chunks.data()[i].optimize();
+        }
+
+        // Heap bytes used by the chunk payloads plus the chunk directory.
+        size_type size_in_bytes() const {
+            size_type result = m_chunks.size() * sizeof(m_Chunk);
+            for(size_type i = 0; i < m_chunks.size(); ++i) result += chunks()[i].bytes();
+            return result;
+        }
+
+        bitmap_set& operator|=(const bitmap_set& other) { return *this = combine(*this, other, m_Op::union_op); }
+        bitmap_set& operator&=(const bitmap_set& other) { return *this = combine(*this, other, m_Op::intersection_op); }
+        bitmap_set& operator-=(const bitmap_set& other) { return *this = combine(*this, other, m_Op::difference_op); }
+
+        friend bitmap_set operator|(const bitmap_set& a, const bitmap_set& b) { return combine(a, b, m_Op::union_op); }
+        friend bitmap_set operator&(const bitmap_set& a, const bitmap_set& b) { return combine(a, b, m_Op::intersection_op); }
+        friend bitmap_set operator-(const bitmap_set& a, const bitmap_set& b) { return combine(a, b, m_Op::difference_op); }
+
+        template <typename... Args>
+        s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+            s21::vector<std::pair<iterator, bool>> result;
+            (result.push_back(insert(std::forward<Args>(args))), ...);
+            return result;
+        }
+    };
+} // namespace s21
+#endif
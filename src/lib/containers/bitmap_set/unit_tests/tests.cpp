@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "./../s21_bitmap_set.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+namespace {
+    template <typename T>
+    std::vector<T> to_vector(const bitmap_set<T>& s) {
+        std::vector<T> result;
+        for(T value : s) result.push_back(value);
+        return result;
+    }
+
+    template <typename T>
+    std::vector<T> to_vector(const std::set<T>& s) {
+        return std::vector<T>(s.begin(), s.end());
+    }
+
+    // Sparse values, a dense block that needs a bitmap chunk and two long runs.
+    std::set<uint32_t> mixed_values(uint32_t seed) {
+        std::mt19937 gen(seed);
+        std::set<uint32_t> values;
+        for(int i = 0; i < 3000; ++i) values.insert(gen());
+        for(int i = 0; i < 20000; ++i) values.insert((5u << 16) | (gen() & 0xFFFF));
+        for(uint32_t v = (9u << 16) + 100; v < (9u << 16) + 30000; ++v) values.insert(v);
+        for(uint32_t v = 0xFFFFFF00u; v != 0; ++v) values.insert(v);
+        return values;
+    }
+
+    bitmap_set<uint32_t> from_set(const std::set<uint32_t>& values) {
+        bitmap_set<uint32_t> result;
+        for(uint32_t value : values) result.insert(value);
+        return result;
+    }
+} // namespace
+
+TEST(bitmapSetTest, DefaultConstructor) {
+    bitmap_set<uint32_t> s;
+    EXPECT_TRUE(s.empty());
+    EXPECT_TRUE(s.begin() == s.end());
+    EXPECT_TRUE(s.lower_bound(5) == s.end());
+    EXPECT_EQ(s.rank(100), (size_t) 0);
+}
+
+TEST(bitmapSetTest, OrderedIteration) {
+    bitmap_set<uint32_t> s{70000, 3, 1, 65536, 3, 4000000000u};
+    EXPECT_EQ(s.size(), (size_t) 5);
+    EXPECT_EQ(to_vector(s), (std::vector<uint32_t>{1, 3, 65536, 70000, 4000000000u}));
+    std::vector<uint32_t> backward;
+    for(auto it = s.end(); it != s.begin();) backward.push_back(*--it);
+    EXPECT_EQ(backward, (std::vector<uint32_t>{4000000000u, 70000, 65536, 3, 1}));
+}
+
+TEST(bitmapSetTest, InsertEraseAcrossChunkKinds) {
+    std::set<uint32_t> expected = mixed_values(1);
+    bitmap_set<uint32_t> s = from_set(expected);
+    EXPECT_EQ(to_vector(s), to_vector(expected));
+
+    std::mt19937 gen(2);
+    for(int i = 0; i < 20000; ++i) {
+        auto it = expected.lower_bound(gen());
+        if(it == expected.end()) continue;
+        uint32_t value = *it;
+        EXPECT_EQ(s.erase(value), expected.erase(value));
+    }
+    EXPECT_EQ(s.size(), expected.size());
+    EXPECT_EQ(to_vector(s), to_vector(expected));
+    EXPECT_FALSE(s.insert(*expected.begin()).second);
+}
+
+TEST(bitmapSetTest, DenseChunkShrinksBackToArray) {
+    bitmap_set<uint32_t> s;
+    for(uint32_t v = 0; v < 10000; ++v) s.insert(v * 2);
+    size_t dense = s.size_in_bytes();
+    for(uint32_t v = 0; v < 9000; ++v) s.erase(v * 2);
+    EXPECT_EQ(s.size(), (size_t) 1000);
+    EXPECT_LT(s.size_in_bytes(), dense);
+    EXPECT_EQ(*s.begin(), (uint32_t) 18000);
+}
+
+TEST(bitmapSetTest, LowerUpperBoundFindContains) {
+    std::set<uint32_t> expected = mixed_values(3);
+    bitmap_set<uint32_t> s = from_set(expected);
+    std::mt19937 gen(4);
+    for(int i = 0; i < 2000; ++i) {
+        uint32_t probe = i % 2 ? gen() : (9u << 16) + gen() % 40000;
+        auto lb = expected.lower_bound(probe);
+        auto it = s.lower_bound(probe);
+        if(lb == expected.end()) {
+            EXPECT_TRUE(it == s.end());
+        } else {
+            EXPECT_EQ(*it, *lb);
+        }
+        auto ub = expected.upper_bound(probe);
+        if(ub != expected.end()) {
+            EXPECT_EQ(*s.upper_bound(probe), *ub);
+        }
+        EXPECT_EQ(s.contains(probe), expected.count(probe) == 1);
+        EXPECT_EQ(s.find(probe) != s.end(), expected.count(probe) == 1);
+    }
+    EXPECT_TRUE(s.upper_bound(0xFFFFFFFFu) == s.end());
+}
+
+TEST(bitmapSetTest, RankAndSelect) {
+    std::set<uint32_t> expected = mixed_values(5);
+    bitmap_set<uint32_t> s = from_set(expected);
+    s.run_optimize();
+    std::vector<uint32_t> sorted = to_vector(expected);
+    for(size_t i = 0; i < sorted.size(); i += 97) {
+        EXPECT_EQ(*s.select(i), sorted[i]);
+        EXPECT_EQ(s.rank(sorted[i]), i + 1);
+    }
+    EXPECT_TRUE(s.select(sorted.size()) == s.end());
+    EXPECT_EQ(s.rank(0xFFFFFFFFu), sorted.size());
+}
+
+TEST(bitmapSetTest, RunOptimizeShrinksClusteredData) {
+    bitmap_set<uint32_t> s;
+    for(uint32_t v = 1000; v < 200000; ++v) s.insert(v);
+    size_t before = s.size_in_bytes();
+    std::vector<uint32_t> values = to_vector(s);
+    s.run_optimize();
+    EXPECT_LT(s.size_in_bytes(), before / 100);
+    EXPECT_EQ(to_vector(s), values);
+    EXPECT_TRUE(s.insert(500000).second);
+    EXPECT_EQ(s.erase(1500), (size_t) 1);
+    EXPECT_FALSE(s.contains(1500));
+    EXPECT_EQ(s.size(), values.size());
+}
+
+TEST(bitmapSetTest, SetAlgebraMatchesStd) {
+    std::set<uint32_t> a = mixed_values(6);
+    std::set<uint32_t> b = mixed_values(7);
+    bitmap_set<uint32_t> x = from_set(a);
+    bitmap_set<uint32_t> y = from_set(b);
+    y.run_optimize();
+
+    std::vector<uint32_t> expected;
+    std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+    EXPECT_EQ(to_vector(x | y), expected);
+
+    expected.clear();
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+    bitmap_set<uint32_t> both = x & y;
+    EXPECT_EQ(to_vector(both), expected);
+    EXPECT_EQ(both.size(), expected.size());
+
+    expected.clear();
+    std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+    x -= y;
+    EXPECT_EQ(to_vector(x), expected);
+}
+
+TEST(bitmapSetTest, SixtyFourBitValues) {
+    bitmap_set<uint64_t> s{1ull << 40, 5, (1ull << 40) + 1, 0xFFFFFFFFFFFFFFFFull};
+    EXPECT_EQ(to_vector(s), (std::vector<uint64_t>{5, 1ull << 40, (1ull << 40) + 1, 0xFFFFFFFFFFFFFFFFull}));
+    EXPECT_EQ(*s.lower_bound(6), 1ull << 40);
+    EXPECT_EQ(s.rank(1ull << 40), (size_t) 2);
+}
+
+TEST(bitmapSetTest, CopyMoveMergeSwap) {
+    bitmap_set<uint32_t> a{1, 2, 3};
+    bitmap_set<uint32_t> b(a);
+    EXPECT_TRUE(a == b);
+    b.insert(100000);
+    EXPECT_FALSE(a == b);
+    a.merge(b);
+    EXPECT_EQ(a.size(), (size_t) 4);
+    EXPECT_TRUE(b.empty());
+    bitmap_set<uint32_t> c(std::move(a));
+    EXPECT_EQ(c.size(), (size_t) 4);
+    b = c;
+    EXPECT_TRUE(b == c);
+    b.swap(a);
+    EXPECT_TRUE(b.empty());
+    b.erase(b.end());
+    auto res = b.insert_many(7u, 7u);
+    EXPECT_TRUE(res[0].second);
+    EXPECT_FALSE(res[1].second);
+    b.erase(b.find(7));
+    EXPECT_TRUE(b.empty());
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
@@ -0,0 +1,34 @@
+#ifndef S21_CONTAINERS_ACCESS
+#define S21_CONTAINERS_ACCESS
+
+#include <stdexcept>
+
+// Element access policy shared by the containers. With checking on, operator[], front(), back()
+// and iterator dereference validate their argument and throw std::out_of_range. With it off they
+// are a bare load, which lets the compiler vectorize loops over operator[]. at() checks either way.
+//
+// Checking follows the build type (on unless NDEBUG is set); define S21_CHECKED_ACCESS to 0 or 1
+// to choose explicitly. Every translation unit of a program must see the same value.
+#ifndef S21_CHECKED_ACCESS
+#ifdef NDEBUG
+#define S21_CHECKED_ACCESS 0
+#else
+#define S21_CHECKED_ACCESS 1
+#endif
+#endif
+
+namespace s21 {
+    inline constexpr bool checked_access = S21_CHECKED_ACCESS;
+
+    // Throws when checking is on and ok is false; compiles to nothing otherwise.
+    inline void check_access(bool ok, const char* what) {
+        if constexpr(checked_access) {
+            if(!ok) throw std::out_of_range(what);
+        } else {
+            (void) ok;
+            (void) what;
+        }
+    }
+} // namespace s21
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef S21_CONTAINERS_INDEXED_ITERATOR
+#define S21_CONTAINERS_INDEXED_ITERATOR
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "./s21_access.h"
+
+namespace s21 {
+    // Random-access iterator that is a container pointer plus an element index, for containers whose
+    // elements are not one contiguous array (deque blocks, concurrent_vector segments, soa_vector
+    // columns). Everything but dereference is index arithmetic. Dereference calls the owner's
+    //     template <typename Self> static decltype(auto) iterator_element(Self& self, size_type index);
+    // with Self being Owner or const Owner, and converts the result to Reference; the hook does the
+    // owner's bounds check. An owner declares the iterator a friend so that the hook and the
+    // (owner, index) constructor can stay private, and the iterator befriends Owner in turn so the
+    // owner can read the index back.
+    //
+    // pointer and operator-> exist only when Reference is a real reference; proxy references (a
+    // tuple of field references for soa_vector) have no address to hand out.
+    template <typename Owner, bool IsConst, typename Reference>
+    class indexed_iterator {
+        friend Owner;
+        template <typename, bool, typename>
+        friend class indexed_iterator;
+
+        using owner_type = std::conditional_t<IsConst, const Owner, Owner>;
+        using size_type = typename Owner::size_type;
+
+        owner_type* m_owner;
+        size_type m_index;
+
+        indexed_iterator(owner_type* owner, size_type index) : m_owner(owner), m_index(index) {}
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = typename Owner::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<std::is_reference_v<Reference>, std::remove_reference_t<Reference>*, void>;
+        using reference = Reference;
+
+        indexed_iterator() : m_owner(nullptr), m_index(0) {}
+
+        // iterator converts to const_iterator.
+        // cppcheck-suppress noExplicitConstructor
+        template <typename OtherReference>
+            requires(IsConst)
+        indexed_iterator(const indexed_iterator<Owner, false, OtherReference>& other) :
+            m_owner(other.m_owner), m_index(other.m_index) {}
+
+        reference operator*() const {
+            check_access(m_owner != nullptr, "Iterator is not bound to a container");
+            return Owner::iterator_element(*m_owner, m_index);
+        }
+
+        pointer operator->() const
+            requires std::is_reference_v<Reference>
+        {
+            return std::addressof(**this);
+        }
+
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        // Position of the element in its container.
+        size_type index() const noexcept { return m_index; }
+
+        indexed_iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+
+        indexed_iterator operator++(int) {
+            indexed_iterator tmp = *this;
+            ++m_index;
+            return tmp;
+        }
+
+        indexed_iterator& operator--() {
+            --m_index;
+            return *this;
+        }
+
+        indexed_iterator operator--(int) {
+            indexed_iterator tmp = *this;
+            --m_index;
+            return tmp;
+        }
+
+        indexed_iterator& operator+=(difference_type n) {
+            m_index += n;
+            return *this;
+        }
+
+        indexed_iterator& operator-=(difference_type n) {
+            m_index -= n;
+            return *this;
+        }
+
+        friend indexed_iterator operator+(indexed_iterator it, difference_type n) { return it += n; }
+
+        friend indexed_iterator operator+(difference_type n, indexed_iterator it) { return it += n; }
+
+        friend indexed_iterator operator-(indexed_iterator it, difference_type n) { return it -= n; }
+
+        friend difference_type operator-(const indexed_iterator& a, const indexed_iterator& b) {
+            return static_cast<difference_type>(a.m_index) - static_cast<difference_type>(b.m_index);
+        }
+
+        bool operator==(const indexed_iterator& other) const { return m_index == other.m_index; }
+
+        auto operator<=>(const indexed_iterator& other) const { return m_index <=> other.m_index; }
+    };
+} // namespace s21
+
+#endif
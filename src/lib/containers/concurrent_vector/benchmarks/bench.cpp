@@ -0,0 +1,95 @@
+// Appends from 1, 2, 4, ... threads up to the hardware concurrency: concurrent_vector::push_back
+// against push_back into an s21::vector under a std::mutex, which is what the collectors did
+// before. Each thread appends its share of the elements; every line reports the total rate.
+// A last pass repeats the concurrent appends while one more thread keeps reading.
+//
+// Usage: bench_s21_concurrent_vector [element_count]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+#include "./../../vector/s21_vector.h"
+#include "./../s21_concurrent_vector.h"
+
+namespace {
+    template <typename Body>
+    double measure(Body body) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(stop - start).count();
+    }
+
+    // Runs body(thread_index) on the given number of threads and waits for all of them.
+    template <typename Body>
+    void on_threads(size_t threads, Body body) {
+        s21::vector<std::thread> workers;
+        for(size_t t = 0; t < threads; ++t) workers.push_back(std::thread(body, t));
+        for(std::thread& worker : workers) worker.join();
+    }
+
+    void report(const char* name, size_t threads, size_t ops, double seconds) {
+        std::printf("%-28s %3zu threads %10.2f Mops/s\n", name, threads, ops / seconds / 1e6);
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 8000000;
+    size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::printf("uint64_t, %zu appends, up to %zu threads\n", n, hardware);
+    uint64_t sink = 0;
+
+    for(size_t threads = 1;; threads = std::min(threads * 2, hardware)) {
+        size_t share = n / threads;
+        {
+            s21::concurrent_vector<uint64_t> v;
+            report("concurrent_vector::push_back", threads, share * threads, measure([&] {
+                       on_threads(threads, [&](size_t t) {
+                           for(size_t i = 0; i < share; ++i) v.push_back(t * share + i);
+                       });
+                   }));
+            sink += v.back();
+        }
+        {
+            s21::vector<uint64_t> v;
+            std::mutex mutex;
+            report("vector::push_back + mutex", threads, share * threads, measure([&] {
+                       on_threads(threads, [&](size_t t) {
+                           for(size_t i = 0; i < share; ++i) {
+                               std::lock_guard<std::mutex> lock(mutex);
+                               v.push_back(t * share + i);
+                           }
+                       });
+                   }));
+            sink += v.back();
+        }
+        if(threads == hardware) break;
+    }
+
+    s21::concurrent_vector<uint64_t> v;
+    std::atomic<bool> done(false);
+    std::thread reader([&] {
+        uint64_t sum = 0;
+        while(!done.load(std::memory_order_relaxed)) {
+            size_t size = v.size();
+            for(size_t i = 0; i < size; i += 64) sum += v.ready(i) ? v[i] : 0;
+        }
+        sink += sum;
+    });
+    size_t share = n / hardware;
+    report("push_back with a reader", hardware, share * hardware, measure([&] {
+               on_threads(hardware, [&](size_t t) {
+                   for(size_t i = 0; i < share; ++i) v.push_back(t * share + i);
+               });
+           }));
+    done = true;
+    reader.join();
+    if(sink == 42) std::printf("\n");
+    return 0;
+}
@@ -0,0 +1,483 @@
+#ifndef S21_CONTAINERS_CONCURRENT_VECTOR
+#define S21_CONTAINERS_CONCURRENT_VECTOR
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "./../common/s21_access.h"
+#include "./../common/s21_indexed_iterator.h"
+
+namespace s21 {
+    // Vector that many threads can append to at once while others read the elements already there.
+    // An append reserves its indices with one fetch_add on the size and then constructs in place, so
+    // push_back and grow_by never take a lock and never wait for each other. Storage is a fixed table
+    // of segments that double in size: segment 0 holds the first block_size() elements and segment k
+    // holds indices [block_size() << (k - 1), block_size() << k). Segments are allocated on first use
+    // and published with a compare-and-swap, and an element never moves once constructed, so
+    // pointers, references and iterators to it stay valid until clear() or destruction.
+    //
+    // Safe to call concurrently with each other: push_back, emplace_back, grow_by,
+    // grow_to_at_least, reserve, size, capacity, ready, operator[], at, and the iterators. Everything
+    // else (assignment, clear, swap, destruction) needs the caller to have stopped all other access.
+    // The allocator is called from the appending threads, so it must be thread-safe; for the pmr
+    // alias that means a synchronized resource.
+    //
+    // size() counts reserved slots, including ones whose constructor is still running on another
+    // thread and ones whose segment is not allocated yet. A reader that did not learn an index from
+    // the thread that appended it checks ready() first, or uses at(); ready() is an acquire load that
+    // pairs with the release store made after construction. With S21_CHECKED_ACCESS on, operator[],
+    // front(), back() and iterator dereference check ready() too and throw on a slot that is not.
+    // With it off they do not, so a range-for over the vector while other threads append must test
+    // ready() for every index it reads.
+    template <typename T, typename Allocator = std::allocator<T>>
+    class concurrent_vector {
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using reference = T&;
+        using const_reference = const T&;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+
+    private:
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using state_type = std::atomic<std::uint8_t>;
+
+        // Per-element construction state, stored in the bytes that follow a segment's elements.
+        enum : std::uint8_t { m_empty = 0, m_constructed = 1, m_broken = 2 };
+
+        // About 4 KiB for the first segment, rounded down to a power of two and never below 16 elements.
+        static constexpr size_type m_first = std::max<size_type>(16, std::bit_floor(std::max<size_type>(1, 4096 / sizeof(T))));
+        static constexpr size_type m_first_shift = std::countr_zero(m_first);
+        static constexpr size_type m_segment_count = std::numeric_limits<size_type>::digits - m_first_shift + 1;
+
+        std::atomic<T*> m_segments[m_segment_count];
+        std::atomic<size_type> m_size;
+        [[no_unique_address]] Allocator m_alloc;
+
+        static constexpr size_type segment_of(size_type index) noexcept { return std::bit_width(index >> m_first_shift); }
+
+        static constexpr size_type segment_base(size_type segment) noexcept {
+            return segment == 0 ? 0 : m_first << (segment - 1);
+        }
+
+        static constexpr size_type segment_size(size_type segment) noexcept {
+            return segment == 0 ? m_first : m_first << (segment - 1);
+        }
+
+        // Elements plus enough trailing T-sized slots to hold one state byte per element.
+        static constexpr size_type allocation_size(size_type segment) noexcept {
+            size_type count = segment_size(segment);
+            return count + (count + sizeof(T) - 1) / sizeof(T);
+        }
+
+        static state_type* states(T* data, size_type segment) noexcept {
+            return std::launder(reinterpret_cast<state_type*>(data + segment_size(segment)));
+        }
+
+        T* slot(size_type index) const noexcept {
+            size_type segment = segment_of(index);
+            return m_segments[segment].load(std::memory_order_acquire) + (index - segment_base(segment));
+        }
+
+        state_type& state(size_type index) const noexcept {
+            size_type segment = segment_of(index);
+            T* data = m_segments[segment].load(std::memory_order_acquire);
+            return states(data, segment)[index - segment_base(segment)];
+        }
+
+        // Returns the segment, allocating it if no other thread has yet. When two threads race, the
+        // one whose compare-and-swap fails hands its block back and uses the winner's.
+        T* acquire_segment(size_type segment) {
+            T* data = m_segments[segment].load(std::memory_order_acquire);
+            if(data != nullptr) return data;
+            T* fresh = alloc_traits::allocate(m_alloc, allocation_size(segment));
+            state_type* flags = reinterpret_cast<state_type*>(fresh + segment_size(segment));
+            for(size_type i = 0; i < segment_size(segment); ++i) ::new(static_cast<void*>(flags + i)) state_type(m_empty);
+            if(m_segments[segment].compare_exchange_strong(data, fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return fresh;
+            }
+            alloc_traits::deallocate(m_alloc, fresh, allocation_size(segment));
+            return data;
+        }
+
+        void acquire_segments(size_type first, size_type last) {
+            if(first == last) return;
+            for(size_type segment = segment_of(first); segment <= segment_of(last - 1); ++segment) acquire_segment(segment);
+        }
+
+        // Constructs the reserved slots [first, last) one by one. If a constructor throws, that slot
+        // and the ones after it are marked broken, so the destructor skips them and ready() stays false.
+        template <typename Construct>
+        void fill_reserved(size_type first, size_type last, Construct construct) {
+            size_type index = first;
+            try {
+                acquire_segments(first, last);
+                for(; index < last; ++index) {
+                    construct(slot(index), index - first);
+                    state(index).store(m_constructed, std::memory_order_release);
+                }
+            }
+            catch(...) {
+                for(; index < last; ++index) {
+                    if(m_segments[segment_of(index)].load(std::memory_order_acquire) != nullptr) {
+                        state(index).store(m_broken, std::memory_order_release);
+                    }
+                }
+                throw;
+            }
+        }
+
+        // ready() costs two acquire loads, so unchecked builds skip the call altogether.
+        void check_ready(size_type pos, const char* what) const {
+            if constexpr(checked_access) check_access(ready(pos), what);
+        }
+
+        template <typename... Args>
+        void construct(T* place, Args&&... args) {
+            alloc_traits::construct(m_alloc, place, std::forward<Args>(args)...);
+        }
+
+        size_type reserve_slots(size_type count) {
+            if(count > max_size()) throw std::length_error("concurrent_vector is too long");
+            size_type first = m_size.fetch_add(count, std::memory_order_relaxed);
+            if(first > max_size() - count) {
+                m_size.fetch_sub(count, std::memory_order_relaxed);
+                throw std::length_error("concurrent_vector is too long");
+            }
+            return first;
+        }
+
+        // Destroys the constructed elements and frees every segment.
+        void release() noexcept {
+            size_type size = m_size.load(std::memory_order_relaxed);
+            for(size_type segment = 0; segment < m_segment_count; ++segment) {
+                T* data = m_segments[segment].exchange(nullptr, std::memory_order_relaxed);
+                if(data == nullptr) continue;
+                size_type base = segment_base(segment);
+                size_type used = size > base ? std::min(size - base, segment_size(segment)) : 0;
+                state_type* flags = states(data, segment);
+                for(size_type i = 0; i < used; ++i) {
+                    if(flags[i].load(std::memory_order_relaxed) == m_constructed) alloc_traits::destroy(m_alloc, data + i);
+                }
+                alloc_traits::deallocate(m_alloc, data, allocation_size(segment));
+            }
+            m_size.store(0, std::memory_order_relaxed);
+        }
+
+        void steal(concurrent_vector& other) noexcept {
+            for(size_type segment = 0; segment < m_segment_count; ++segment) {
+                m_segments[segment].store(other.m_segments[segment].exchange(nullptr, std::memory_order_relaxed),
+                                          std::memory_order_relaxed);
+            }
+            m_size.store(other.m_size.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+
+        // Copies other slot by slot, so a broken slot stays broken at the same index.
+        template <typename Source>
+        void copy_from(Source&& other) {
+            static_assert(std::is_same_v<std::remove_cvref_t<Source>, concurrent_vector>);
+            size_type count = other.size();
+            acquire_segments(0, count);
+            for(size_type i = 0; i < count; ++i) {
+                m_size.store(i + 1, std::memory_order_relaxed);
+                if(other.ready(i)) {
+                    if constexpr(std::is_const_v<std::remove_reference_t<Source>>) {
+                        construct(slot(i), std::as_const(*other.slot(i)));
+                    } else {
+                        construct(slot(i), std::move(*other.slot(i)));
+                    }
+                    state(i).store(m_constructed, std::memory_order_relaxed);
+                } else {
+                    state(i).store(m_broken, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Dereference hook for indexed_iterator; checks ready() rather than size(), see above.
+        template <typename Self>
+        static decltype(auto) iterator_element(Self& self, size_type index) {
+            self.check_ready(index, "Concurrent vector iterator out of range");
+            return *self.slot(index);
+        }
+
+        template <typename, bool, typename>
+        friend class indexed_iterator;
+
+    public:
+        using iterator = indexed_iterator<concurrent_vector, false, T&>;
+        using const_iterator = indexed_iterator<concurrent_vector, true, const T&>;
+
+        concurrent_vector() : concurrent_vector(Allocator()) {}
+
+        explicit concurrent_vector(const Allocator& alloc) noexcept : m_segments{}, m_size(0), m_alloc(alloc) {}
+
+        // The constructors below delegate, so the destructor cleans up if filling throws.
+        explicit concurrent_vector(size_type count, const Allocator& alloc = Allocator()) : concurrent_vector(alloc) {
+            grow_by(count);
+        }
+
+        explicit concurrent_vector(std::initializer_list<value_type> const& items, const Allocator& alloc = Allocator()) :
+            concurrent_vector(alloc) {
+            grow_by(items.begin(), items.end());
+        }
+
+        concurrent_vector(const concurrent_vector& other) :
+            concurrent_vector(other, alloc_traits::select_on_container_copy_construction(other.m_alloc)) {}
+
+        concurrent_vector(const concurrent_vector& other, const Allocator& alloc) : concurrent_vector(alloc) {
+            copy_from(other);
+        }
+
+        concurrent_vector(concurrent_vector&& other) noexcept : concurrent_vector(std::move(other.m_alloc)) { steal(other); }
+
+        // Takes other's segments when the allocators are equal, otherwise moves the elements one by one.
+        concurrent_vector(concurrent_vector&& other, const Allocator& alloc) : concurrent_vector(alloc) {
+            if(m_alloc == other.m_alloc) {
+                steal(other);
+            } else {
+                copy_from(std::move(other));
+            }
+        }
+
+        ~concurrent_vector() { release(); }
+
+        concurrent_vector& operator=(const concurrent_vector& other) {
+            if(this != &other) {
+                clear();
+                copy_from(other);
+            }
+            return *this;
+        }
+
+        concurrent_vector& operator=(concurrent_vector&& other) noexcept(
+            alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) {
+            if(this == &other) return *this;
+            if constexpr(alloc_traits::propagate_on_container_move_assignment::value) {
+                release();
+                m_alloc = std::move(other.m_alloc);
+                steal(other);
+            } else {
+                if(m_alloc == other.m_alloc) {
+                    release();
+                    steal(other);
+                } else {
+                    clear();
+                    copy_from(std::move(other));
+                    other.clear();
+                }
+            }
+            return *this;
+        }
+
+        concurrent_vector& operator=(std::initializer_list<value_type> const& items) {
+            clear();
+            grow_by(items.begin(), items.end());
+            return *this;
+        }
+
+        allocator_type get_allocator() const noexcept { return m_alloc; }
+
+        iterator begin() noexcept { return iterator(this, 0); }
+        iterator end() noexcept { return iterator(this, size()); }
+        const_iterator begin() const noexcept { return const_iterator(this, 0); }
+        const_iterator end() const noexcept { return const_iterator(this, size()); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator cend() const noexcept { return end(); }
+
+        // Throws for indices past size() and for slots that are not constructed (yet, or ever).
+        // cppcheck-suppress passedByValue
+        reference at(size_type pos) {
+            if(!ready(pos)) throw std::out_of_range("Index out of range");
+            return *slot(pos);
+        }
+
+        // cppcheck-suppress passedByValue
+        const_reference at(size_type pos) const {
+            if(!ready(pos)) throw std::out_of_range("Index out of range");
+            return *slot(pos);
+        }
+
+        // cppcheck-suppress passedByValue
+        reference operator[](size_type pos) {
+            check_ready(pos, "Index out of range");
+            return *slot(pos);
+        }
+
+        // cppcheck-suppress passedByValue
+        const_reference operator[](size_type pos) const {
+            check_ready(pos, "Index out of range");
+            return *slot(pos);
+        }
+
+        reference front() {
+            check_ready(0, "concurrent_vector element is not ready");
+            return *slot(0);
+        }
+
+        const_reference front() const {
+            check_ready(0, "concurrent_vector element is not ready");
+            return *slot(0);
+        }
+
+        reference back() {
+            size_type last = size() - 1;
+            check_ready(last, "concurrent_vector element is not ready");
+            return *slot(last);
+        }
+
+        const_reference back() const {
+            size_type last = size() - 1;
+            check_ready(last, "concurrent_vector element is not ready");
+            return *slot(last);
+        }
+
+        // True once the element at pos has been constructed and published.
+        bool ready(size_type pos) const noexcept {
+            if(pos >= size()) return false;
+            size_type segment = segment_of(pos);
+            T* data = m_segments[segment].load(std::memory_order_acquire);
+            return data != nullptr &&
+                   states(data, segment)[pos - segment_base(segment)].load(std::memory_order_acquire) == m_constructed;
+        }
+
+        bool empty() const noexcept { return size() == 0; }
+
+        size_type size() const noexcept { return m_size.load(std::memory_order_acquire); }
+
+        // cppcheck-suppress functionStatic
+        size_type max_size() const noexcept {
+            return std::min(std::numeric_limits<size_type>::max() / 2, std::numeric_limits<size_type>::max() / sizeof(value_type));
+        }
+
+        // Elements that fit before the first segment that is not allocated yet.
+        size_type capacity() const noexcept {
+            size_type segment = 0;
+            while(segment < m_segment_count && m_segments[segment].load(std::memory_order_acquire) != nullptr) ++segment;
+            return segment_base(segment);
+        }
+
+        // Allocates the segments covering the first count elements, so appends up to there allocate nothing.
+        void reserve(size_type count) {
+            if(count > max_size()) throw std::length_error("concurrent_vector is too long");
+            acquire_segments(0, count);
+        }
+
+        static constexpr size_type block_size() noexcept { return m_first; }
+
+        // Keeps the segments. A failed append may have reserved indices in segments it could not
+        // allocate, so those are skipped as in release().
+        void clear() noexcept {
+            size_type size = m_size.load(std::memory_order_relaxed);
+            for(size_type segment = 0; segment < m_segment_count && segment_base(segment) < size; ++segment) {
+                T* data = m_segments[segment].load(std::memory_order_relaxed);
+                if(data == nullptr) continue;
+                size_type used = std::min(size - segment_base(segment), segment_size(segment));
+                state_type* flags = states(data, segment);
+                for(size_type i = 0; i < used; ++i) {
+                    if(flags[i].load(std::memory_order_relaxed) == m_constructed) alloc_traits::destroy(m_alloc, data + i);
+                    flags[i].store(m_empty, std::memory_order_relaxed);
+                }
+            }
+            m_size.store(0, std::memory_order_relaxed);
+        }
+
+        // Returns every segment to the allocator once the vector is empty.
+        void shrink_to_fit() noexcept {
+            if(empty()) release();
+        }
+
+        template <typename... Args>
+        iterator emplace_back(Args&&... args) {
+            size_type index = reserve_slots(1);
+            fill_reserved(index, index + 1, [&](T* place, size_type) { construct(place, std::forward<Args>(args)...); });
+            return iterator(this, index);
+        }
+
+        // cppcheck-suppress passedByValue
+        iterator push_back(const_reference value) { return emplace_back(value); }
+
+        iterator push_back(value_type&& value) { return emplace_back(std::move(value)); }
+
+        // Appends count value-initialized elements as one contiguous run of indices and returns an
+        // iterator to the first of them.
+        iterator grow_by(size_type count) {
+            size_type first = reserve_slots(count);
+            fill_reserved(first, first + count, [&](T* place, size_type) { construct(place); });
+            return iterator(this, first);
+        }
+
+        // cppcheck-suppress passedByValue
+        iterator grow_by(size_type count, const_reference value) {
+            size_type first = reserve_slots(count);
+            fill_reserved(first, first + count, [&](T* place, size_type) { construct(place, value); });
+            return iterator(this, first);
+        }
+
+        template <std::forward_iterator ForwardIt>
+        iterator grow_by(ForwardIt source_first, ForwardIt source_last) {
+            size_type count = static_cast<size_type>(std::distance(source_first, source_last));
+            size_type first = reserve_slots(count);
+            fill_reserved(first, first + count, [&](T* place, size_type) { construct(place, *source_first++); });
+            return iterator(this, first);
+        }
+
+        iterator grow_by(std::initializer_list<value_type> const& items) { return grow_by(items.begin(), items.end()); }
+
+        // Makes the vector at least count elements long, value-initializing whatever this call
+        // appends. Returns an iterator to the first appended element, or to count if another thread
+        // got there first and nothing was appended.
+        iterator grow_to_at_least(size_type count) {
+            if(count > max_size()) throw std::length_error("concurrent_vector is too long");
+            size_type current = m_size.load(std::memory_order_relaxed);
+            while(current < count) {
+                if(m_size.compare_exchange_weak(current, count, std::memory_order_relaxed)) {
+                    fill_reserved(current, count, [&](T* place, size_type) { construct(place); });
+                    return iterator(this, current);
+                }
+            }
+            return iterator(this, count);
+        }
+
+        // Allocators are exchanged only when they propagate on swap; otherwise they must be equal.
+        void swap(concurrent_vector& other) noexcept {
+            if constexpr(alloc_traits::propagate_on_container_swap::value) std::swap(m_alloc, other.m_alloc);
+            for(size_type segment = 0; segment < m_segment_count; ++segment) {
+                T* mine = m_segments[segment].load(std::memory_order_relaxed);
+                m_segments[segment].store(other.m_segments[segment].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                other.m_segments[segment].store(mine, std::memory_order_relaxed);
+            }
+            size_type size = m_size.load(std::memory_order_relaxed);
+            m_size.store(other.m_size.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            other.m_size.store(size, std::memory_order_relaxed);
+        }
+
+        bool operator==(const concurrent_vector& other) const {
+            return std::equal(begin(), end(), other.begin(), other.end());
+        }
+
+        bool operator!=(const concurrent_vector& other) const { return !(*this == other); }
+    };
+
+    // Concurrent vectors whose segments come from a std::pmr::memory_resource. Appending threads
+    // allocate, so use a std::pmr::synchronized_pool_resource or another thread-safe resource.
+    namespace pmr {
+        template <typename T>
+        using concurrent_vector = s21::concurrent_vector<T, std::pmr::polymorphic_allocator<T>>;
+    } // namespace pmr
+} // namespace s21
+
+#endif
@@ -0,0 +1,327 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory_resource>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "./../../vector/s21_vector.h"
+#include "./../s21_concurrent_vector.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+namespace {
+    // Throws from the constructor once the shared countdown reaches zero.
+    struct Fragile {
+        static inline int countdown = -1;
+        static inline int alive = 0;
+        int value;
+
+        explicit Fragile(int v = 0) : value(v) {
+            if(countdown >= 0 && countdown-- == 0) throw std::runtime_error("Fragile");
+            ++alive;
+        }
+        Fragile(const Fragile& other) : Fragile(other.value) {}
+        ~Fragile() { --alive; }
+    };
+
+    // Forwards to new/delete but throws bad_alloc once `allowed` allocations have succeeded.
+    class FailingResource : public std::pmr::memory_resource {
+    public:
+        int allowed = -1;
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            if(allowed == 0) throw std::bad_alloc();
+            if(allowed > 0) --allowed;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+} // namespace
+
+TEST(concurrentVectorTest, PushBackAndAccess) {
+    concurrent_vector<int> v;
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(v.capacity(), 0u);
+    for(int i = 0; i < 1000; ++i) {
+        auto it = v.push_back(i);
+        EXPECT_EQ(*it, i);
+        EXPECT_EQ(it - v.begin(), i);
+    }
+    EXPECT_EQ(v.size(), 1000u);
+    EXPECT_EQ(v.front(), 0);
+    EXPECT_EQ(v.back(), 999);
+    EXPECT_EQ(v[500], 500);
+    EXPECT_EQ(v.at(999), 999);
+    EXPECT_THROW(v.at(1000), std::out_of_range);
+    EXPECT_GE(v.capacity(), 1000u);
+    int expected = 0;
+    for(int x : v) EXPECT_EQ(x, expected++);
+}
+
+TEST(concurrentVectorTest, SegmentsDoubleAndElementsNeverMove) {
+    concurrent_vector<int> v;
+    const size_t block = concurrent_vector<int>::block_size();
+    v.push_back(1);
+    EXPECT_EQ(v.capacity(), block);
+    int* first = &v[0];
+    v.grow_by(block);
+    EXPECT_EQ(v.capacity(), 2 * block);
+    v.grow_by(block);
+    EXPECT_EQ(v.capacity(), 4 * block);
+    EXPECT_EQ(&v[0], first);
+    EXPECT_EQ(v[0], 1);
+    EXPECT_EQ(v[block], 0);
+    v.reserve(100 * block);
+    EXPECT_EQ(v.capacity(), 128 * block);
+    EXPECT_EQ(&v[0], first);
+}
+
+TEST(concurrentVectorTest, GrowByOverloads) {
+    concurrent_vector<std::string> v;
+    auto filled = v.grow_by(3, "x");
+    EXPECT_EQ(filled, v.begin());
+    s21::vector<std::string> words({"a", "b", "c"});
+    auto copied = v.grow_by(words.begin(), words.end());
+    EXPECT_EQ(copied - v.begin(), 3);
+    auto listed = v.grow_by({"d", "e"});
+    EXPECT_EQ(*listed, "d");
+    auto blank = v.grow_by(2);
+    EXPECT_TRUE(blank->empty());
+    EXPECT_EQ(v.size(), 10u);
+    EXPECT_EQ(v[2], "x");
+    EXPECT_EQ(v[5], "c");
+    EXPECT_EQ(v[7], "e");
+}
+
+TEST(concurrentVectorTest, GrowToAtLeast) {
+    concurrent_vector<int> v({1, 2, 3});
+    auto it = v.grow_to_at_least(10);
+    EXPECT_EQ(it - v.begin(), 3);
+    EXPECT_EQ(v.size(), 10u);
+    EXPECT_EQ(v[9], 0);
+    it = v.grow_to_at_least(5);
+    EXPECT_EQ(it - v.begin(), 5);
+    EXPECT_EQ(v.size(), 10u);
+}
+
+TEST(concurrentVectorTest, CopyMoveSwapClear) {
+    concurrent_vector<std::string> a({"one", "two", "three"});
+    concurrent_vector<std::string> b(a);
+    EXPECT_EQ(a, b);
+    concurrent_vector<std::string> c(std::move(b));
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(c, a);
+    c.push_back("four");
+    EXPECT_NE(c, a);
+    a = c;
+    EXPECT_EQ(a.size(), 4u);
+    b = std::move(c);
+    EXPECT_EQ(b, a);
+    concurrent_vector<std::string> d({"z"});
+    d.swap(b);
+    EXPECT_EQ(d.size(), 4u);
+    EXPECT_EQ(b.front(), "z");
+    d.clear();
+    EXPECT_TRUE(d.empty());
+    EXPECT_GT(d.capacity(), 0u);
+    d.push_back("again");
+    EXPECT_EQ(d.back(), "again");
+    d.clear();
+    d.shrink_to_fit();
+    EXPECT_EQ(d.capacity(), 0u);
+    d = {"x", "y"};
+    EXPECT_EQ(d[1], "y");
+}
+
+TEST(concurrentVectorTest, ThrowingConstructorLeavesBrokenSlots) {
+    Fragile::alive = 0;
+    {
+        concurrent_vector<Fragile> v;
+        v.grow_by(5);
+        Fragile::countdown = 2;
+        EXPECT_THROW(v.grow_by(4), std::runtime_error);
+        Fragile::countdown = -1;
+        EXPECT_EQ(v.size(), 9u);
+        EXPECT_TRUE(v.ready(6));
+        EXPECT_FALSE(v.ready(7));
+        EXPECT_FALSE(v.ready(8));
+        EXPECT_THROW(v.at(7), std::out_of_range);
+        if constexpr(checked_access) {
+            EXPECT_THROW(v[7], std::out_of_range);
+            EXPECT_THROW(*(v.begin() + 8), std::out_of_range);
+            EXPECT_THROW(v.back(), std::out_of_range);
+        }
+        v.push_back(Fragile(42));
+        EXPECT_EQ(v.at(9).value, 42);
+        EXPECT_EQ(Fragile::alive, 8);
+
+        concurrent_vector<Fragile> copy(v);
+        EXPECT_FALSE(copy.ready(7));
+        EXPECT_EQ(copy.at(9).value, 42);
+        EXPECT_EQ(Fragile::alive, 16);
+    }
+    EXPECT_EQ(Fragile::alive, 0);
+}
+
+TEST(concurrentVectorTest, FailedSegmentAllocationLeavesUnallocatedSlots) {
+    FailingResource resource;
+    pmr::concurrent_vector<std::string> v(&resource);
+    resource.allowed = 1;
+    EXPECT_THROW(v.grow_by(v.block_size() + 1), std::bad_alloc);
+    EXPECT_EQ(v.size(), v.block_size() + 1);
+    EXPECT_FALSE(v.ready(0));
+    EXPECT_FALSE(v.ready(v.block_size()));
+    if constexpr(checked_access) {
+        EXPECT_THROW(v[v.block_size()], std::out_of_range);
+        EXPECT_THROW(*(v.begin() + v.block_size()), std::out_of_range);
+    }
+    resource.allowed = -1;
+    v.clear();
+    EXPECT_TRUE(v.empty());
+    v.push_back("after");
+    EXPECT_EQ(v[0], "after");
+
+    resource.allowed = 0;
+    EXPECT_THROW(v.grow_by(2 * v.block_size()), std::bad_alloc);
+    resource.allowed = -1;
+    pmr::concurrent_vector<std::string> other(&resource);
+    other.push_back("other");
+    v = other;
+    EXPECT_EQ(v.size(), 1u);
+    EXPECT_EQ(v[0], "other");
+}
+
+TEST(concurrentVectorTest, ConcurrentPushBackKeepsReferencesStable) {
+    concurrent_vector<size_t> v;
+    const size_t threads = 8;
+    const size_t per_thread = 20000;
+    std::atomic<bool> go(false);
+    std::atomic<bool> moved(false);
+    s21::vector<std::thread> workers;
+    for(size_t t = 0; t < threads; ++t) {
+        workers.push_back(std::thread([&, t] {
+            while(!go.load()) std::this_thread::yield();
+            s21::vector<std::pair<const size_t*, size_t>> mine;
+            for(size_t i = 0; i < per_thread; ++i) {
+                size_t value = t * per_thread + i;
+                auto it = v.push_back(value);
+                mine.push_back({&*it, value});
+                // Earlier elements of this thread must not have moved while others appended.
+                const auto& probe = mine[i / 2];
+                if(*probe.first != probe.second) moved = true;
+            }
+        }));
+    }
+    go = true;
+    for(std::thread& worker : workers) worker.join();
+    EXPECT_FALSE(moved.load());
+    ASSERT_EQ(v.size(), threads * per_thread);
+    s21::vector<size_t> seen(v.size());
+    std::copy(v.begin(), v.end(), seen.begin());
+    std::sort(seen.begin(), seen.end());
+    for(size_t i = 0; i < seen.size(); ++i) ASSERT_EQ(seen[i], i);
+}
+
+TEST(concurrentVectorTest, IterateWhileWritersAppend) {
+    concurrent_vector<std::string> v;
+    const size_t writers = 4;
+    const size_t per_writer = 5000;
+    std::atomic<size_t> finished(0);
+    s21::vector<std::thread> threads;
+    for(size_t t = 0; t < writers; ++t) {
+        threads.push_back(std::thread([&, t] {
+            for(size_t i = 0; i < per_writer; ++i) v.push_back(std::string(40, static_cast<char>('a' + t)));
+            ++finished;
+        }));
+    }
+    size_t passes = 0;
+    while(finished.load() < writers || passes == 0) {
+        ++passes;
+        for(auto it = v.begin(), end = v.end(); it != end; ++it) {
+            // size() already counts slots that are still being filled, or whose segment is not there yet.
+            if(!v.ready(static_cast<size_t>(it - v.begin()))) continue;
+            ASSERT_EQ(it->size(), 40u);
+            ASSERT_EQ(std::count(it->begin(), it->end(), (*it)[0]), 40);
+        }
+    }
+    for(std::thread& thread : threads) thread.join();
+    ASSERT_EQ(v.size(), writers * per_writer);
+    size_t count = 0;
+    for(const std::string& s : v) count += s.size() == 40;
+    EXPECT_EQ(count, writers * per_writer);
+}
+
+TEST(concurrentVectorTest, ReadersSeeReadyElements) {
+    concurrent_vector<std::string> v;
+    std::atomic<bool> done(false);
+    std::thread reader([&] {
+        while(!done.load()) {
+            size_t size = v.size();
+            for(size_t i = 0; i < size; ++i) {
+                if(v.ready(i)) {
+                    const std::string& s = v[i];
+                    EXPECT_EQ(s.size(), 40u);
+                    EXPECT_EQ(std::count(s.begin(), s.end(), s[0]), 40);
+                }
+            }
+        }
+    });
+    s21::vector<std::thread> writers;
+    for(int w = 0; w < 2; ++w) {
+        writers.push_back(std::thread([&, w] {
+            for(int i = 0; i < 2000; ++i) v.push_back(std::string(40, static_cast<char>('a' + w)));
+        }));
+    }
+    for(std::thread& writer : writers) writer.join();
+    done = true;
+    reader.join();
+    EXPECT_EQ(v.size(), 4000u);
+}
+
+TEST(concurrentVectorTest, ConcurrentGrowBySegmentsDoNotOverlap) {
+    concurrent_vector<int> v;
+    s21::vector<std::thread> workers;
+    for(int t = 0; t < 4; ++t) {
+        workers.push_back(std::thread([&, t] {
+            for(int i = 0; i < 300; ++i) {
+                auto it = v.grow_by(7, t);
+                for(int k = 0; k < 7; ++k) EXPECT_EQ(it[k], t);
+            }
+        }));
+    }
+    for(std::thread& worker : workers) worker.join();
+    EXPECT_EQ(v.size(), 4u * 300u * 7u);
+    for(size_t i = 0; i < v.size(); i += 7) {
+        for(size_t k = 1; k < 7; ++k) ASSERT_EQ(v[i + k], v[i]);
+    }
+}
+
+TEST(concurrentVectorTest, PmrAlias) {
+    std::pmr::synchronized_pool_resource pool;
+    pmr::concurrent_vector<int> v(&pool);
+    std::thread other([&] {
+        for(int i = 0; i < 5000; ++i) v.push_back(i);
+    });
+    for(int i = 0; i < 5000; ++i) v.push_back(i);
+    other.join();
+    EXPECT_EQ(v.size(), 10000u);
+    EXPECT_EQ(v.get_allocator().resource(), &pool);
+    EXPECT_EQ(std::accumulate(v.begin(), v.end(), 0L), 2L * 4999 * 5000 / 2);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
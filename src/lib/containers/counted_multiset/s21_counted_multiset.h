@@ -0,0 +1,204 @@
+#ifndef S21_CONTAINERS_COUNTED_MULTISET
+#define S21_CONTAINERS_COUNTED_MULTISET
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+
+#include "./../tree/s21_tree.h"
+#include "./../vector/s21_vector.h"
+
+namespace s21 {
+    // multiset that stores each distinct key once, together with its number of copies, so memory
+    // grows with the number of distinct keys rather than with size(). Iteration still yields every
+    // copy, and count() is a single lookup. Because copies are not separate objects, equivalent but
+    // distinguishable keys collapse into the first one inserted.
+    template <typename TKey, typename Compare = std::less<TKey>, typename Balance = red_black_balance,
+              bool Threaded = false>
+    class counted_multiset {
+    public:
+        using key_type = TKey;
+        using value_type = TKey;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using size_type = size_t;
+
+    private:
+        using tree_type = BinaryTree<TKey, size_type, Compare, std::pair<const TKey, size_type>, Balance, Threaded>;
+        using tree_iterator = typename tree_type::iterator;
+
+        tree_type m_tree;
+        size_type m_size = 0;
+
+    public:
+        // Walks the copies of a key before moving on to the next node.
+        class CountedIterator {
+            friend class counted_multiset;
+
+        private:
+            tree_iterator m_it;
+            size_type m_copy;
+
+            CountedIterator(tree_iterator it, size_type copy) : m_it(it), m_copy(copy) {}
+
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = TKey;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const TKey*;
+            using reference = const TKey&;
+
+            CountedIterator() : m_it(), m_copy(0) {}
+
+            const TKey& operator*() const { return (*m_it).first; }
+
+            const TKey* operator->() const { return &(*m_it).first; }
+
+            CountedIterator& operator++() {
+                if(++m_copy == (*m_it).second) {
+                    ++m_it;
+                    m_copy = 0;
+                }
+                return *this;
+            }
+
+            CountedIterator operator++(int) {
+                CountedIterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            CountedIterator& operator--() {
+                if(m_copy > 0) {
+                    --m_copy;
+                } else {
+                    --m_it;
+                    m_copy = (*m_it).second - 1;
+                }
+                return *this;
+            }
+
+            CountedIterator operator--(int) {
+                CountedIterator tmp = *this;
+                --(*this);
+                return tmp;
+            }
+
+            // Copies of the current key left to visit, this one included.
+            size_type run_length() const { return (*m_it).second - m_copy; }
+
+            bool operator==(const CountedIterator& other) const { return m_it == other.m_it && m_copy == other.m_copy; }
+
+            bool operator!=(const CountedIterator& other) const { return !(*this == other); }
+        };
+
+        using iterator = CountedIterator;
+        using const_iterator = CountedIterator;
+
+        counted_multiset() = default;
+
+        explicit counted_multiset(std::initializer_list<TKey> const& list) {
+            for(const auto& value : list) insert(value);
+        }
+
+        counted_multiset(const counted_multiset& other) : m_tree(other.m_tree), m_size(other.m_size) {}
+
+        counted_multiset(counted_multiset&& other) noexcept { swap(other); }
+
+        counted_multiset& operator=(const counted_multiset& other) {
+            if(this != &other) {
+                counted_multiset tmp(other);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        counted_multiset& operator=(counted_multiset&& other) noexcept {
+            if(this != &other) {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        bool operator==(const counted_multiset& other) const { return m_size == other.m_size && m_tree == other.m_tree; }
+
+        ~counted_multiset() = default;
+
+        iterator begin() const { return iterator(m_tree.begin(), 0); }
+        iterator end() const { return iterator(m_tree.end(), 0); }
+        bool empty() const { return m_size == 0; }
+        size_type size() const { return m_size; }
+        size_type max_size() const { return m_tree.max_size(); }
+
+        // Number of distinct keys, i.e. of tree nodes.
+        size_type distinct_size() const { return m_tree.size(); }
+
+        void clear() {
+            m_tree.clear();
+            m_size = 0;
+        }
+
+        // Returns an iterator to the new copy, which comes after the existing ones.
+        iterator insert(const value_type& value) { return insert(value, 1); }
+
+        // Adds copies copies of value in one tree operation.
+        iterator insert(const value_type& value, size_type copies) {
+            if(copies == 0) return find(value);
+            std::pair<tree_iterator, bool> res = m_tree.insert_unique(value, copies);
+            if(!res.second) (*res.first).second += copies;
+            m_size += copies;
+            return iterator(res.first, (*res.first).second - 1);
+        }
+
+        // Removes the one copy pos points to.
+        // cppcheck-suppress passedByValue
+        void erase(iterator pos) {
+            if(pos == end()) return;
+            if(--(*pos.m_it).second == 0) m_tree.erase(pos.m_it);
+            --m_size;
+        }
+
+        // Removes every copy of key and returns how many there were.
+        size_type erase(const key_type& key) {
+            tree_iterator it = m_tree.find(key);
+            if(it == m_tree.end()) return 0;
+            size_type removed = (*it).second;
+            m_tree.erase(it);
+            m_size -= removed;
+            return removed;
+        }
+
+        void swap(counted_multiset& other) noexcept {
+            m_tree.swap(other.m_tree);
+            std::swap(m_size, other.m_size);
+        }
+
+        void merge(counted_multiset& other) {
+            if(this == &other) return;
+            for(tree_iterator it = other.m_tree.begin(); it != other.m_tree.end(); ++it) insert((*it).first, (*it).second);
+            other.clear();
+        }
+
+        size_type count(const key_type& key) const {
+            tree_iterator it = m_tree.find(key);
+            return it == m_tree.end() ? 0 : (*it).second;
+        }
+
+        iterator find(const key_type& key) const { return iterator(m_tree.find(key), 0); }
+        bool contains(const key_type& key) const { return m_tree.contains(key); }
+
+        std::pair<iterator, iterator> equal_range(const key_type& key) const { return {lower_bound(key), upper_bound(key)}; }
+
+        iterator lower_bound(const key_type& key) const { return iterator(m_tree.lower_bound(key), 0); }
+        iterator upper_bound(const key_type& key) const { return iterator(m_tree.upper_bound(key), 0); }
+
+        template <typename... Args>
+        s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+            s21::vector<std::pair<iterator, bool>> result;
+            (result.push_back({insert(std::forward<Args>(args)), true}), ...);
+            return result;
+        }
+    };
+} // namespace s21
+#endif
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <vector>
+
+#include "./../s21_counted_multiset.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+TEST(countedMultisetTest, DefaultConstructor) {
+    counted_multiset<int> s;
+    EXPECT_TRUE(s.empty());
+    EXPECT_TRUE(s.begin() == s.end());
+}
+
+TEST(countedMultisetTest, OneNodePerDistinctKey) {
+    counted_multiset<int> s{3, 1, 3, 3, 2, 1};
+    EXPECT_EQ(s.size(), (size_t) 6);
+    EXPECT_EQ(s.distinct_size(), (size_t) 3);
+    EXPECT_EQ(s.count(3), (size_t) 3);
+    EXPECT_EQ(s.count(1), (size_t) 2);
+    EXPECT_EQ(s.count(4), (size_t) 0);
+}
+
+TEST(countedMultisetTest, IterationYieldsEveryCopy) {
+    counted_multiset<int> s{2, 1, 2, 2};
+    std::vector<int> forward(s.begin(), s.end());
+    EXPECT_EQ(forward, (std::vector<int>{1, 2, 2, 2}));
+
+    std::vector<int> backward;
+    for(auto it = s.end(); it != s.begin();) backward.push_back(*--it);
+    EXPECT_EQ(backward, (std::vector<int>{2, 2, 2, 1}));
+}
+
+TEST(countedMultisetTest, BulkInsert) {
+    counted_multiset<int> s;
+    auto it = s.insert(7, 1000000);
+    EXPECT_EQ(*it, 7);
+    EXPECT_EQ(it.run_length(), (size_t) 1);
+    s.insert(7, 5);
+    EXPECT_EQ(s.count(7), (size_t) 1000005);
+    EXPECT_EQ(s.distinct_size(), (size_t) 1);
+    EXPECT_EQ(s.find(7).run_length(), (size_t) 1000005);
+    s.insert(8, 0);
+    EXPECT_FALSE(s.contains(8));
+}
+
+TEST(countedMultisetTest, EraseOneCopy) {
+    counted_multiset<int> s{5, 5, 6};
+    s.erase(s.find(5));
+    EXPECT_EQ(s.count(5), (size_t) 1);
+    s.erase(s.find(5));
+    EXPECT_FALSE(s.contains(5));
+    EXPECT_EQ(s.distinct_size(), (size_t) 1);
+    s.erase(s.end());
+    EXPECT_EQ(s.size(), (size_t) 1);
+}
+
+TEST(countedMultisetTest, EraseAllCopiesOfKey) {
+    counted_multiset<int> s{1, 2, 2, 2, 3};
+    EXPECT_EQ(s.erase(2), (size_t) 3);
+    EXPECT_EQ(s.erase(2), (size_t) 0);
+    EXPECT_EQ(s.size(), (size_t) 2);
+}
+
+TEST(countedMultisetTest, EqualRangeAndBounds) {
+    counted_multiset<int> s{1, 3, 3, 5};
+    auto range = s.equal_range(3);
+    size_t copies = 0;
+    for(auto it = range.first; it != range.second; ++it, ++copies) EXPECT_EQ(*it, 3);
+    EXPECT_EQ(copies, (size_t) 2);
+    EXPECT_EQ(*s.lower_bound(2), 3);
+    EXPECT_EQ(*s.upper_bound(3), 5);
+    EXPECT_TRUE(s.upper_bound(5) == s.end());
+}
+
+TEST(countedMultisetTest, MatchesStdMultiset) {
+    std::mt19937 gen(5);
+    std::uniform_int_distribution<int> dist(0, 20);
+    counted_multiset<int> s;
+    std::multiset<int> expected;
+    for(int i = 0; i < 5000; ++i) {
+        int key = dist(gen);
+        if(gen() % 4 == 0 && expected.count(key)) {
+            s.erase(s.find(key));
+            expected.erase(expected.find(key));
+        } else {
+            s.insert(key);
+            expected.insert(key);
+        }
+    }
+    EXPECT_EQ(s.size(), expected.size());
+    EXPECT_TRUE(std::equal(s.begin(), s.end(), expected.begin(), expected.end()));
+}
+
+TEST(countedMultisetTest, CopyMoveMergeSwap) {
+    counted_multiset<int> a{1, 1, 2};
+    counted_multiset<int> b(a);
+    EXPECT_TRUE(a == b);
+    b.insert(1);
+    EXPECT_FALSE(a == b);
+    a.merge(b);
+    EXPECT_EQ(a.count(1), (size_t) 5);
+    EXPECT_EQ(a.size(), (size_t) 7);
+    EXPECT_TRUE(b.empty());
+    counted_multiset<int> c(std::move(a));
+    EXPECT_EQ(c.size(), (size_t) 7);
+    EXPECT_TRUE(a.empty());
+    b = c;
+    EXPECT_TRUE(b == c);
+    b.swap(a);
+    EXPECT_TRUE(b.empty());
+    auto res = b.insert_many(4, 4);
+    EXPECT_EQ(b.count(4), (size_t) 2);
+    EXPECT_TRUE(res[1].second);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
@@ -0,0 +1,84 @@
+// Compares stack and queue over s21::deque (the default) against the same adapters over s21::list
+// and against std::stack/std::queue: LIFO push/pop, FIFO push/pop and a queue of steady length,
+// where the deque recycles blocks and the list allocates one node per push.
+//
+// Usage: bench_s21_deque [element_count]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <queue>
+#include <stack>
+
+#include "./../../queue/s21_queue.h"
+#include "./../../stack/s21_stack.h"
+
+namespace {
+    template <typename Body>
+    double measure(Body body) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(stop - start).count();
+    }
+
+    void report(const char* container, const char* phase, size_t ops, double seconds) {
+        std::printf("%-24s %-14s %10.2f Mops/s\n", container, phase, ops / seconds / 1e6);
+    }
+
+    template <typename Stack>
+    void run_stack(const char* container, size_t n) {
+        Stack s;
+        uint64_t sum = 0;
+        report(container, "push", n, measure([&] {
+                   for(size_t i = 0; i < n; ++i) s.push(i);
+               }));
+        report(container, "top + pop", n, measure([&] {
+                   for(size_t i = 0; i < n; ++i) {
+                       sum += s.top();
+                       s.pop();
+                   }
+               }));
+        if(sum == 42) std::printf("\n");
+    }
+
+    template <typename Queue>
+    void run_queue(const char* container, size_t n) {
+        Queue q;
+        uint64_t sum = 0;
+        report(container, "push", n, measure([&] {
+                   for(size_t i = 0; i < n; ++i) q.push(i);
+               }));
+        report(container, "front + pop", n, measure([&] {
+                   for(size_t i = 0; i < n; ++i) {
+                       sum += q.front();
+                       q.pop();
+                   }
+               }));
+        for(size_t i = 0; i < 1000; ++i) q.push(i);
+        report(container, "steady 1000", n, measure([&] {
+                   for(size_t i = 0; i < n; ++i) {
+                       q.push(i);
+                       sum += q.front();
+                       q.pop();
+                   }
+               }));
+        if(sum == 42) std::printf("\n");
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+
+    std::printf("stack of uint64_t, %zu elements\n", n);
+    run_stack<s21::stack<uint64_t>>("s21::stack<deque>", n);
+    run_stack<s21::stack<uint64_t, s21::list<uint64_t>>>("s21::stack<list>", n);
+    run_stack<std::stack<uint64_t>>("std::stack", n);
+
+    std::printf("queue of uint64_t, %zu elements\n", n);
+    run_queue<s21::queue<uint64_t>>("s21::queue<deque>", n);
+    run_queue<s21::queue<uint64_t, s21::list<uint64_t>>>("s21::queue<list>", n);
+    run_queue<std::queue<uint64_t>>("std::queue", n);
+    return 0;
+}
@@ -0,0 +1,412 @@
+#ifndef S21_CONTAINERS_DEQUE
+#define S21_CONTAINERS_DEQUE
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "./../common/s21_access.h"
+#include "./../common/s21_indexed_iterator.h"
+
+namespace s21 {
+    // Double-ended queue over fixed-size blocks. A circular map holds the block pointers, so pushing
+    // or popping at either end is O(1) and never moves an element, and operator[] is two shifts and a
+    // mask away from the element. Blocks are allocated as the ends reach them and returned as they
+    // empty; one freed block is kept aside, so a queue that stays about the same size reuses the
+    // block its head leaves behind for its tail instead of going back to the allocator.
+    //
+    // Unlike std::deque, inserting or erasing in the middle is not supported.
+    template <typename T, typename Allocator = std::allocator<T>>
+    class deque {
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using reference = T&;
+        using const_reference = const T&;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+
+    private:
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using map_allocator = typename alloc_traits::template rebind_alloc<T*>;
+        using map_traits = std::allocator_traits<map_allocator>;
+
+        // About 4 KiB per block, rounded down to a power of two and never below 16 elements.
+        static constexpr size_type m_block_size = std::max<size_type>(16, std::bit_floor(std::max<size_type>(1, 4096 / sizeof(T))));
+        static constexpr size_type m_block_shift = std::countr_zero(m_block_size);
+
+        // Logical block k lives in map slot (m_head + k) & (m_map_capacity - 1), and element i sits at
+        // offset m_start + i counted from the beginning of logical block 0. Exactly the blocks that
+        // hold elements are allocated; an empty deque holds none and has m_start == 0.
+        T** m_map;
+        size_type m_map_capacity;
+        size_type m_head;
+        size_type m_start;
+        size_type m_size;
+        T* m_spare;
+        [[no_unique_address]] Allocator m_alloc;
+
+        T*& block(size_type logical) const noexcept { return m_map[(m_head + logical) & (m_map_capacity - 1)]; }
+
+        T* slot(size_type index) const noexcept {
+            size_type offset = m_start + index;
+            return block(offset >> m_block_shift) + (offset & (m_block_size - 1));
+        }
+
+        size_type used_blocks() const noexcept {
+            return m_size == 0 ? 0 : ((m_start + m_size - 1) >> m_block_shift) + 1;
+        }
+
+        T* acquire_block() {
+            if(m_spare != nullptr) return std::exchange(m_spare, nullptr);
+            return alloc_traits::allocate(m_alloc, m_block_size);
+        }
+
+        void release_block(T* data) noexcept {
+            if(m_spare == nullptr) {
+                m_spare = data;
+            } else {
+                alloc_traits::deallocate(m_alloc, data, m_block_size);
+            }
+        }
+
+        // Makes room in the map for one more block, unrolling the ring into a map twice as large.
+        void reserve_map_slot() {
+            size_type used = used_blocks();
+            if(used < m_map_capacity) return;
+            map_allocator map_alloc(m_alloc);
+            size_type capacity = std::max<size_type>(8, m_map_capacity * 2);
+            T** map = map_traits::allocate(map_alloc, capacity);
+            std::fill(map, map + capacity, nullptr);
+            for(size_type k = 0; k < used; ++k) map[k] = block(k);
+            if(m_map != nullptr) map_traits::deallocate(map_alloc, m_map, m_map_capacity);
+            m_map = map;
+            m_map_capacity = capacity;
+            m_head = 0;
+        }
+
+        template <typename... Args>
+        void construct(T* place, Args&&... args) {
+            alloc_traits::construct(m_alloc, place, std::forward<Args>(args)...);
+        }
+
+        // Drops the last block once the deque runs empty, restoring the empty-state invariant.
+        void reset_if_empty() noexcept {
+            if(m_size != 0) return;
+            if(m_map != nullptr && block(0) != nullptr) release_block(std::exchange(block(0), nullptr));
+            m_head = 0;
+            m_start = 0;
+        }
+
+        // Destroys the elements and frees every block and the map.
+        void release() noexcept {
+            clear();
+            if(m_spare != nullptr) alloc_traits::deallocate(m_alloc, m_spare, m_block_size);
+            m_spare = nullptr;
+            if(m_map != nullptr) {
+                map_allocator map_alloc(m_alloc);
+                map_traits::deallocate(map_alloc, m_map, m_map_capacity);
+            }
+            m_map = nullptr;
+            m_map_capacity = 0;
+        }
+
+        void steal(deque& other) noexcept {
+            m_map = std::exchange(other.m_map, nullptr);
+            m_map_capacity = std::exchange(other.m_map_capacity, 0);
+            m_head = std::exchange(other.m_head, 0);
+            m_start = std::exchange(other.m_start, 0);
+            m_size = std::exchange(other.m_size, 0);
+            m_spare = std::exchange(other.m_spare, nullptr);
+        }
+
+        template <typename InputIt>
+        void append(InputIt first, InputIt last) {
+            for(; first != last; ++first) emplace_back(*first);
+        }
+
+        template <typename Tuple, size_t... I>
+        void emplace_front_reversed(Tuple&& items, std::index_sequence<I...>) {
+            constexpr size_t last = sizeof...(I) - 1;
+            (emplace_front(std::get<last - I>(std::move(items))), ...);
+        }
+
+        // Dereference hook for indexed_iterator: a bounds-checked lookup through the block map.
+        template <typename Self>
+        static decltype(auto) iterator_element(Self& self, size_type index) {
+            check_access(index < self.m_size, "Deque iterator out of range");
+            return *self.slot(index);
+        }
+
+        template <typename, bool, typename>
+        friend class indexed_iterator;
+
+    public:
+        using iterator = indexed_iterator<deque, false, T&>;
+        using const_iterator = indexed_iterator<deque, true, const T&>;
+
+        deque() : deque(Allocator()) {}
+
+        explicit deque(const Allocator& alloc) noexcept :
+            m_map(nullptr), m_map_capacity(0), m_head(0), m_start(0), m_size(0), m_spare(nullptr), m_alloc(alloc) {}
+
+        // The constructors below delegate, so the destructor cleans up if filling throws.
+        explicit deque(size_type count, const Allocator& alloc = Allocator()) : deque(alloc) {
+            for(size_type i = 0; i < count; ++i) emplace_back();
+        }
+
+        explicit deque(std::initializer_list<value_type> const& items, const Allocator& alloc = Allocator()) : deque(alloc) {
+            append(items.begin(), items.end());
+        }
+
+        deque(const deque& other) : deque(other, alloc_traits::select_on_container_copy_construction(other.m_alloc)) {}
+
+        deque(const deque& other, const Allocator& alloc) : deque(alloc) { append(other.begin(), other.end()); }
+
+        deque(deque&& other) noexcept : deque(std::move(other.m_alloc)) { steal(other); }
+
+        // Takes other's blocks when the allocators are equal, otherwise moves the elements one by one.
+        deque(deque&& other, const Allocator& alloc) : deque(alloc) {
+            if(m_alloc == other.m_alloc) {
+                steal(other);
+            } else {
+                append(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            }
+        }
+
+        ~deque() { release(); }
+
+        deque& operator=(const deque& other) {
+            if(this != &other) {
+                clear();
+                for(const_reference item : other) push_back(item);
+            }
+            return *this;
+        }
+
+        deque& operator=(deque&& other) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                                 alloc_traits::is_always_equal::value) {
+            if(this == &other) return *this;
+            if constexpr(alloc_traits::propagate_on_container_move_assignment::value) {
+                release();
+                m_alloc = std::move(other.m_alloc);
+                steal(other);
+            } else {
+                if(m_alloc == other.m_alloc) {
+                    release();
+                    steal(other);
+                } else {
+                    clear();
+                    for(reference item : other) push_back(std::move(item));
+                    other.clear();
+                }
+            }
+            return *this;
+        }
+
+        deque& operator=(std::initializer_list<value_type> const& items) {
+            clear();
+            for(const_reference item : items) push_back(item);
+            return *this;
+        }
+
+        allocator_type get_allocator() const noexcept { return m_alloc; }
+
+        iterator begin() noexcept { return iterator(this, 0); }
+        iterator end() noexcept { return iterator(this, m_size); }
+        const_iterator begin() const noexcept { return const_iterator(this, 0); }
+        const_iterator end() const noexcept { return const_iterator(this, m_size); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator cend() const noexcept { return end(); }
+
+        // cppcheck-suppress passedByValue
+        reference at(size_type pos) {
+            if(pos >= m_size) throw std::out_of_range("Index out of range");
+            return *slot(pos);
+        }
+
+        // cppcheck-suppress passedByValue
+        const_reference at(size_type pos) const {
+            if(pos >= m_size) throw std::out_of_range("Index out of range");
+            return *slot(pos);
+        }
+
+        // cppcheck-suppress passedByValue
+        reference operator[](size_type pos) {
+            check_access(pos < m_size, "Index out of range");
+            return *slot(pos);
+        }
+
+        // cppcheck-suppress passedByValue
+        const_reference operator[](size_type pos) const {
+            check_access(pos < m_size, "Index out of range");
+            return *slot(pos);
+        }
+
+        reference front() {
+            check_access(m_size > 0, "deque is empty");
+            return *slot(0);
+        }
+
+        const_reference front() const {
+            check_access(m_size > 0, "deque is empty");
+            return *slot(0);
+        }
+
+        reference back() {
+            check_access(m_size > 0, "deque is empty");
+            return *slot(m_size - 1);
+        }
+
+        const_reference back() const {
+            check_access(m_size > 0, "deque is empty");
+            return *slot(m_size - 1);
+        }
+
+        bool empty() const noexcept { return m_size == 0; }
+
+        size_type size() const noexcept { return m_size; }
+
+        // cppcheck-suppress functionStatic
+        size_type max_size() const noexcept { return std::numeric_limits<size_type>::max() / sizeof(value_type); }
+
+        static constexpr size_type block_size() noexcept { return m_block_size; }
+
+        void clear() noexcept {
+            while(m_size > 0) {
+                alloc_traits::destroy(m_alloc, slot(m_size - 1));
+                --m_size;
+                if(((m_start + m_size) & (m_block_size - 1)) == 0 && m_size > 0) {
+                    release_block(std::exchange(block((m_start + m_size) >> m_block_shift), nullptr));
+                }
+            }
+            reset_if_empty();
+        }
+
+        // Returns the spare block to the allocator.
+        void shrink_to_fit() noexcept {
+            if(m_spare != nullptr) alloc_traits::deallocate(m_alloc, m_spare, m_block_size);
+            m_spare = nullptr;
+        }
+
+        template <typename... Args>
+        reference emplace_back(Args&&... args) {
+            size_type offset = m_start + m_size;
+            if((offset & (m_block_size - 1)) == 0) {
+                reserve_map_slot();
+                T* fresh = acquire_block();
+                try {
+                    construct(fresh, std::forward<Args>(args)...);
+                }
+                catch(...) {
+                    release_block(fresh);
+                    throw;
+                }
+                block(offset >> m_block_shift) = fresh;
+            } else {
+                construct(slot(m_size), std::forward<Args>(args)...);
+            }
+            ++m_size;
+            return back();
+        }
+
+        template <typename... Args>
+        reference emplace_front(Args&&... args) {
+            if(m_start == 0) {
+                reserve_map_slot();
+                T* fresh = acquire_block();
+                try {
+                    construct(fresh + m_block_size - 1, std::forward<Args>(args)...);
+                }
+                catch(...) {
+                    release_block(fresh);
+                    throw;
+                }
+                m_head = (m_head + m_map_capacity - 1) & (m_map_capacity - 1);
+                block(0) = fresh;
+                m_start = m_block_size - 1;
+            } else {
+                construct(slot(0) - 1, std::forward<Args>(args)...);
+                --m_start;
+            }
+            ++m_size;
+            return front();
+        }
+
+        // cppcheck-suppress passedByValue
+        void push_back(const_reference value) { emplace_back(value); }
+
+        void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+        // cppcheck-suppress passedByValue
+        void push_front(const_reference value) { emplace_front(value); }
+
+        void push_front(value_type&& value) { emplace_front(std::move(value)); }
+
+        void pop_back() {
+            if(empty()) throw std::out_of_range("There are nothing to pop");
+            alloc_traits::destroy(m_alloc, slot(m_size - 1));
+            --m_size;
+            size_type offset = m_start + m_size;
+            if((offset & (m_block_size - 1)) == 0 && m_size > 0) release_block(std::exchange(block(offset >> m_block_shift), nullptr));
+            reset_if_empty();
+        }
+
+        void pop_front() {
+            if(empty()) throw std::out_of_range("There are nothing to pop");
+            alloc_traits::destroy(m_alloc, slot(0));
+            --m_size;
+            if(++m_start == m_block_size && m_size > 0) {
+                release_block(std::exchange(block(0), nullptr));
+                m_head = (m_head + 1) & (m_map_capacity - 1);
+                m_start = 0;
+            }
+            reset_if_empty();
+        }
+
+        // Allocators are exchanged only when they propagate on swap; otherwise they must be equal.
+        void swap(deque& other) noexcept {
+            if constexpr(alloc_traits::propagate_on_container_swap::value) std::swap(m_alloc, other.m_alloc);
+            std::swap(m_map, other.m_map);
+            std::swap(m_map_capacity, other.m_map_capacity);
+            std::swap(m_head, other.m_head);
+            std::swap(m_start, other.m_start);
+            std::swap(m_size, other.m_size);
+            std::swap(m_spare, other.m_spare);
+        }
+
+        template <typename... Args>
+        void insert_many_back(Args&&... args) {
+            (emplace_back(std::forward<Args>(args)), ...);
+        }
+
+        // The arguments end up in the order given, in front of the current first element. They are
+        // emplaced last to first, so the stored elements are never moved.
+        template <typename... Args>
+        void insert_many_front(Args&&... args) {
+            emplace_front_reversed(std::forward_as_tuple(std::forward<Args>(args)...), std::index_sequence_for<Args...>());
+        }
+
+        bool operator==(const deque& other) const { return std::equal(begin(), end(), other.begin(), other.end()); }
+
+        bool operator!=(const deque& other) const { return !(*this == other); }
+    };
+
+    // Deques whose blocks and map come from a std::pmr::memory_resource.
+    namespace pmr {
+        template <typename T>
+        using deque = s21::deque<T, std::pmr::polymorphic_allocator<T>>;
+    } // namespace pmr
+} // namespace s21
+
+#endif
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <memory_resource>
+#include <random>
+#include <string>
+
+#include "./../s21_deque.h"
+#include "./../testing_include/counting_resource.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+static_assert(std::random_access_iterator<s21::deque<int>::iterator>);
+static_assert(std::random_access_iterator<s21::deque<int>::const_iterator>);
+
+TEST(dequeTest, DefaultConstructorDoesNotAllocate) {
+    CountingResource resource;
+    s21::pmr::deque<int> d(&resource);
+    EXPECT_TRUE(d.empty());
+    EXPECT_TRUE(d.begin() == d.end());
+    EXPECT_EQ(resource.allocations, (size_t) 0);
+}
+
+TEST(dequeTest, PushAndPopAtBothEnds) {
+    s21::deque<int> d;
+    for(int i = 0; i < 1000; ++i) {
+        d.push_back(i);
+        d.push_front(-i - 1);
+    }
+    ASSERT_EQ(d.size(), (size_t) 2000);
+    EXPECT_EQ(d.front(), -1000);
+    EXPECT_EQ(d.back(), 999);
+    for(int i = 0; i < 2000; ++i) ASSERT_EQ(d[i], i - 1000);
+    for(int i = 0; i < 500; ++i) {
+        d.pop_front();
+        d.pop_back();
+    }
+    EXPECT_EQ(d.size(), (size_t) 1000);
+    EXPECT_EQ(d.front(), -500);
+    EXPECT_EQ(d.at(999), 499);
+    EXPECT_THROW(d.at(1000), std::out_of_range);
+}
+
+TEST(dequeTest, MatchesStdDequeUnderRandomOperations) {
+    s21::deque<std::string> d;
+    std::deque<std::string> expected;
+    std::mt19937 rng(7);
+    for(int step = 0; step < 50000; ++step) {
+        unsigned op = rng() % 5;
+        std::string value = std::to_string(step);
+        if(op == 0) {
+            d.push_back(value);
+            expected.push_back(value);
+        } else if(op == 1) {
+            d.emplace_front(value);
+            expected.push_front(value);
+        } else if(op == 2 && !expected.empty()) {
+            d.pop_back();
+            expected.pop_back();
+        } else if(op == 3 && !expected.empty()) {
+            d.pop_front();
+            expected.pop_front();
+        } else if(!expected.empty()) {
+            size_t index = rng() % expected.size();
+            ASSERT_EQ(d[index], expected[index]);
+        }
+        ASSERT_EQ(d.size(), expected.size());
+    }
+    EXPECT_TRUE(std::equal(d.begin(), d.end(), expected.begin(), expected.end()));
+}
+
+TEST(dequeTest, SteadyQueueReusesBlocks) {
+    CountingResource resource;
+    s21::pmr::deque<int> d(&resource);
+    for(int i = 0; i < 100; ++i) d.push_back(i);
+    for(int i = 0; i < 2000; ++i) {
+        d.push_back(i);
+        d.pop_front();
+    }
+    size_t before = resource.allocations;
+    for(int i = 0; i < 100000; ++i) {
+        d.push_back(i);
+        d.pop_front();
+    }
+    EXPECT_EQ(resource.allocations, before);
+    EXPECT_EQ(d.size(), (size_t) 100);
+    EXPECT_EQ(d.back(), 99999);
+}
+
+TEST(dequeTest, CopyMoveAndSwap) {
+    s21::deque<std::string> a{std::string("x"), std::string("y"), std::string("z")};
+    s21::deque<std::string> copy(a);
+    EXPECT_TRUE(copy == a);
+    s21::deque<std::string> moved(std::move(a));
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(moved.at(2), "z");
+    a = moved;
+    EXPECT_EQ(a.size(), (size_t) 3);
+    s21::deque<std::string> other{std::string("q")};
+    a.swap(other);
+    EXPECT_EQ(a.size(), (size_t) 1);
+    EXPECT_EQ(other.back(), "z");
+    other = std::move(a);
+    EXPECT_EQ(other.front(), "q");
+    other.push_back("tail");
+    EXPECT_EQ(other.size(), (size_t) 2);
+}
+
+TEST(dequeTest, IteratorsWorkWithAlgorithms) {
+    s21::deque<int> d;
+    for(int i = 0; i < 300; ++i) d.push_front(i);
+    std::sort(d.begin(), d.end());
+    EXPECT_EQ(d.front(), 0);
+    EXPECT_EQ(d.back(), 299);
+    auto it = std::lower_bound(d.begin(), d.end(), 150);
+    EXPECT_EQ(it - d.begin(), 150);
+    EXPECT_EQ(it[10], 160);
+    const s21::deque<int>& view = d;
+    s21::deque<int>::const_iterator first = d.begin();
+    EXPECT_TRUE(first == view.begin());
+    EXPECT_EQ(*(view.end() - 1), 299);
+}
+
+TEST(dequeTest, InsertManyAtBothEnds) {
+    s21::deque<int> d{3};
+    d.insert_many_back(4, 5);
+    d.insert_many_front(1, 2);
+    s21::deque<int> expected{1, 2, 3, 4, 5};
+    EXPECT_TRUE(d == expected);
+
+    // Not assignable, so nothing already stored can be shuffled to make room.
+    struct Pinned {
+        const int value;
+    };
+    s21::deque<Pinned> pinned;
+    pinned.emplace_back(Pinned{3});
+    pinned.insert_many_front(Pinned{1}, Pinned{2});
+    pinned.insert_many_front();
+    ASSERT_EQ(pinned.size(), (size_t) 3);
+    for(int i = 0; i < 3; ++i) EXPECT_EQ(pinned[i].value, i + 1);
+}
+
+TEST(dequeTest, PmrElementsUseResource) {
+    CountingResource resource;
+    {
+        s21::pmr::deque<std::pmr::string> d(&resource);
+        d.emplace_back(std::string(100, 'a'));
+        d.emplace_front(std::string(100, 'b'));
+        EXPECT_EQ(d.front().get_allocator().resource(), &resource);
+        EXPECT_EQ(d.back().get_allocator().resource(), &resource);
+        d.clear();
+        d.shrink_to_fit();
+    }
+    EXPECT_EQ(resource.live_bytes, (size_t) 0);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
@@ -0,0 +1,113 @@
+#ifndef S21_CONTAINERS_FLAT_MAP
+#define S21_CONTAINERS_FLAT_MAP
+
+#include <functional>
+#include <initializer_list>
+
+#include "./../tree/s21_flat_tree.h"
+#include "./../vector/s21_vector.h"
+
+namespace s21 {
+    // map over a sorted vector (see FlatTree). Same interface as map, except that elements are
+    // stored as std::pair<TKey, TValue> and any insert or erase invalidates iterators.
+    template <typename TKey, typename TValue, typename Compare = std::less<TKey>>
+    class flat_map {
+    private:
+        FlatTree<TKey, std::pair<TKey, TValue>, Compare, true> m_tree;
+
+    public:
+        using key_type = TKey;
+        using mapped_type = TValue;
+        using value_type = std::pair<key_type, mapped_type>;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using iterator = typename FlatTree<TKey, value_type, Compare, true>::iterator;
+        using const_iterator = typename FlatTree<TKey, value_type, Compare, true>::const_iterator;
+        using size_type = size_t;
+
+        flat_map() = default;
+
+        explicit flat_map(std::initializer_list<value_type> const& list) { m_tree.insert_range(list.begin(), list.end()); }
+
+        flat_map(const flat_map& other) = default;
+        flat_map(flat_map&& other) noexcept = default;
+
+        flat_map& operator=(const flat_map& other) = default;
+        flat_map& operator=(flat_map&& other) noexcept = default;
+
+        bool operator==(const flat_map& other) const { return m_tree == other.m_tree; }
+        mapped_type& operator[](const key_type& key) { return at(key); }
+
+        ~flat_map() = default;
+
+        mapped_type& at(const key_type& key) {
+            iterator it = m_tree.find(key);
+            if(it == m_tree.end()) {
+                auto res = insert({key, mapped_type()});
+                return (*res.first).second;
+            }
+            return (*it).second;
+        }
+
+        iterator begin() const { return m_tree.begin(); }
+        iterator end() const { return m_tree.end(); }
+        bool empty() const { return m_tree.empty(); }
+        size_type size() const { return m_tree.size(); }
+        size_type max_size() const { return m_tree.max_size(); }
+        void clear() { m_tree.clear(); }
+
+        // cppcheck-suppress unusedFunction
+        void reserve(size_type count) { m_tree.reserve(count); }
+        // cppcheck-suppress unusedFunction
+        void shrink_to_fit() { m_tree.shrink_to_fit(); }
+
+        std::pair<iterator, bool> insert(const value_type& value) { return m_tree.insert(value); }
+
+        std::pair<iterator, bool> insert(const key_type& key, const mapped_type& obj) { return m_tree.insert({key, obj}); }
+
+        // cppcheck-suppress unusedFunction
+        std::pair<iterator, bool> insert_or_assign(const key_type& key, const mapped_type& obj) {
+            std::pair<iterator, bool> res = m_tree.insert({key, obj});
+            if(!res.second) { (*res.first).second = obj; }
+            return res;
+        }
+
+        // Inserts a whole batch with one sort and one merge; keys already present are kept.
+        template <typename InputIt>
+        void insert_range(InputIt first, InputIt last) {
+            m_tree.insert_range(first, last);
+        }
+
+        // cppcheck-suppress passedByValue
+        void erase(iterator pos) { m_tree.erase(pos); }
+        void swap(flat_map& other) noexcept { m_tree.swap(other.m_tree); }
+        void merge(flat_map& other) {
+            if(this == &other) return;
+            m_tree.insert_range(other.begin(), other.end());
+            other.clear();
+        }
+
+        iterator find(const key_type& key) const { return m_tree.find(key); }
+        bool contains(const key_type& key) const { return m_tree.contains(key); }
+
+        iterator lower_bound(const key_type& key) const { return m_tree.lower_bound(key); }
+        iterator upper_bound(const key_type& key) const { return m_tree.upper_bound(key); }
+
+        // Hinted search: gallops outwards from an iterator close to the key.
+        // cppcheck-suppress passedByValue
+        iterator find(iterator from, const key_type& key) const { return m_tree.find(from, key); }
+        // cppcheck-suppress passedByValue
+        iterator lower_bound(iterator from, const key_type& key) const { return m_tree.lower_bound(from, key); }
+        // cppcheck-suppress passedByValue
+        iterator upper_bound(iterator from, const key_type& key) const { return m_tree.upper_bound(from, key); }
+
+        template <typename... Args>
+        s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+            s21::vector<std::pair<iterator, bool>> result;
+            result.reserve(sizeof...(args));
+            (result.push_back(insert(std::forward<Args>(args))), ...);
+            return result;
+        }
+    };
+} // namespace s21
+#endif
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "./../s21_flat_map.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+TEST(flatMapTest, DefaultConstructor) {
+    flat_map<int, int> m;
+    EXPECT_TRUE(m.empty());
+    EXPECT_TRUE(m.begin() == m.end());
+}
+
+TEST(flatMapTest, ListConstructorSortsAndKeepsFirst) {
+    flat_map<int, char> m{{3, 'c'}, {1, 'a'}, {2, 'b'}, {1, 'z'}};
+    EXPECT_EQ(m.size(), (size_t) 3);
+    int expected = 1;
+    for(const auto& item : m) { EXPECT_EQ(item.first, expected++); }
+    EXPECT_EQ(m.at(1), 'a');
+}
+
+TEST(flatMapTest, InsertAndAssign) {
+    flat_map<std::string, int> m;
+    EXPECT_TRUE(m.insert("b", 2).second);
+    EXPECT_TRUE(m.insert({"a", 1}).second);
+    EXPECT_FALSE(m.insert("a", 5).second);
+    EXPECT_EQ(m["a"], 1);
+    m.insert_or_assign("a", 5);
+    EXPECT_EQ(m["a"], 5);
+    m["c"] = 3;
+    EXPECT_EQ(m.size(), (size_t) 3);
+    EXPECT_EQ((m.end() - 1)->first, "c");
+}
+
+TEST(flatMapTest, FindBoundsAndErase) {
+    flat_map<int, int> m{{10, 1}, {20, 2}, {30, 3}};
+    EXPECT_EQ(m.find(20)->second, 2);
+    EXPECT_TRUE(m.find(25) == m.end());
+    EXPECT_EQ(m.lower_bound(15)->first, 20);
+    EXPECT_EQ(m.upper_bound(20)->first, 30);
+    EXPECT_TRUE(m.upper_bound(30) == m.end());
+    m.erase(m.find(20));
+    EXPECT_FALSE(m.contains(20));
+    EXPECT_EQ(m.size(), (size_t) 2);
+}
+
+TEST(flatMapTest, InsertRangeMatchesStdMap) {
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> dist(0, 500);
+    flat_map<int, int> m;
+    std::map<int, int> expected;
+    for(int round = 0; round < 10; ++round) {
+        std::vector<std::pair<int, int>> batch;
+        for(int i = 0; i < 100; ++i) batch.emplace_back(dist(gen), round * 1000 + i);
+        m.insert_range(batch.begin(), batch.end());
+        for(const auto& item : batch) expected.insert(item);
+    }
+    ASSERT_EQ(m.size(), expected.size());
+    auto it = m.begin();
+    for(const auto& item : expected) {
+        EXPECT_EQ(it->first, item.first);
+        EXPECT_EQ(it->second, item.second);
+        ++it;
+    }
+}
+
+TEST(flatMapTest, HintedSearch) {
+    flat_map<int, int> m;
+    for(int i = 0; i < 1000; i += 2) m.insert(i, i);
+    auto hint = m.begin();
+    for(int key = 0; key < 1000; ++key) {
+        hint = m.lower_bound(hint, key);
+        EXPECT_TRUE(hint == m.lower_bound(key));
+    }
+    EXPECT_EQ(m.find(m.end(), 500)->second, 500);
+    EXPECT_TRUE(m.find(m.begin(), 501) == m.end());
+    EXPECT_EQ(m.upper_bound(m.end(), 4)->first, 6);
+}
+
+TEST(flatMapTest, CopyMoveSwapMerge) {
+    flat_map<int, int> a{{1, 1}, {3, 3}};
+    flat_map<int, int> b(a);
+    EXPECT_TRUE(a == b);
+    flat_map<int, int> c(std::move(b));
+    EXPECT_TRUE(c == a);
+    flat_map<int, int> d{{2, 20}, {3, 30}};
+    c.swap(d);
+    EXPECT_EQ(c.at(2), 20);
+    a.merge(c);
+    EXPECT_TRUE(c.empty());
+    EXPECT_EQ(a.size(), (size_t) 3);
+    EXPECT_EQ(a.at(3), 3);
+    d = a;
+    EXPECT_TRUE(d == a);
+}
+
+TEST(flatMapTest, InsertMany) {
+    flat_map<int, int> m;
+    auto res = m.insert_many(std::pair<int, int>{1, 1}, std::pair<int, int>{1, 2}, std::pair<int, int>{2, 2});
+    EXPECT_TRUE(res[0].second);
+    EXPECT_FALSE(res[1].second);
+    EXPECT_TRUE(res[2].second);
+    EXPECT_EQ(m.size(), (size_t) 2);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
@@ -0,0 +1,94 @@
+#ifndef S21_CONTAINERS_FLAT_MULTISET
+#define S21_CONTAINERS_FLAT_MULTISET
+
+#include <functional>
+#include <initializer_list>
+
+#include "./../tree/s21_flat_tree.h"
+#include "./../vector/s21_vector.h"
+
+namespace s21 {
+    // multiset over a sorted vector (see FlatTree). Same interface as multiset; equal keys keep
+    // their insertion order and any insert or erase invalidates iterators.
+    template <typename TKey, typename Compare = std::less<TKey>>
+    class flat_multiset {
+    private:
+        FlatTree<TKey, TKey, Compare, false> m_tree;
+
+    public:
+        using key_type = TKey;
+        using value_type = TKey;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using iterator = typename FlatTree<TKey, TKey, Compare, false>::iterator;
+        using const_iterator = typename FlatTree<TKey, TKey, Compare, false>::const_iterator;
+        using size_type = size_t;
+
+        flat_multiset() = default;
+
+        explicit flat_multiset(std::initializer_list<TKey> const& list) { m_tree.insert_range(list.begin(), list.end()); }
+
+        flat_multiset(const flat_multiset& other) = default;
+        flat_multiset(flat_multiset&& other) noexcept = default;
+
+        flat_multiset& operator=(flat_multiset&& other) noexcept = default;
+        flat_multiset& operator=(const flat_multiset& other) = default;
+
+        bool operator==(const flat_multiset& other) const { return m_tree == other.m_tree; }
+        ~flat_multiset() = default;
+
+        iterator begin() const { return m_tree.begin(); }
+        iterator end() const { return m_tree.end(); }
+        bool empty() const { return m_tree.empty(); }
+        size_type size() const { return m_tree.size(); }
+        size_type max_size() const { return m_tree.max_size(); }
+        void clear() { m_tree.clear(); }
+
+        // cppcheck-suppress unusedFunction
+        void reserve(size_type count) { m_tree.reserve(count); }
+        // cppcheck-suppress unusedFunction
+        void shrink_to_fit() { m_tree.shrink_to_fit(); }
+
+        iterator insert(const value_type& value) { return m_tree.insert(value).first; }
+
+        // Inserts a whole batch with one sort and one merge.
+        template <typename InputIt>
+        void insert_range(InputIt first, InputIt last) {
+            m_tree.insert_range(first, last);
+        }
+
+        // cppcheck-suppress passedByValue
+        void erase(iterator pos) { m_tree.erase(pos); }
+        void swap(flat_multiset& other) noexcept { m_tree.swap(other.m_tree); }
+        void merge(flat_multiset& other) {
+            if(this == &other) return;
+            m_tree.insert_range(other.begin(), other.end());
+            other.clear();
+        }
+
+        size_type count(const key_type& key) const { return m_tree.count(key); }
+        iterator find(const key_type& key) const { return m_tree.find(key); }
+        bool contains(const key_type& key) const { return m_tree.contains(key); }
+
+        std::pair<iterator, iterator> equal_range(const key_type& key) const { return m_tree.equal_range(key); }
+
+        iterator lower_bound(const key_type& key) const { return m_tree.lower_bound(key); }
+        iterator upper_bound(const key_type& key) const { return m_tree.upper_bound(key); }
+
+        // Hinted search: gallops outwards from an iterator close to the key.
+        // cppcheck-suppress passedByValue
+        iterator find(iterator from, const key_type& key) const { return m_tree.find(from, key); }
+        // cppcheck-suppress passedByValue
+        iterator lower_bound(iterator from, const key_type& key) const { return m_tree.lower_bound(from, key); }
+        // cppcheck-suppress passedByValue
+        iterator upper_bound(iterator from, const key_type& key) const { return m_tree.upper_bound(from, key); }
+
+        template <typename... Args>
+        s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+            s21::vector<std::pair<iterator, bool>> result;
+            (result.push_back({insert(std::forward<Args>(args)), true}), ...);
+            return result;
+        }
+    };
+} // namespace s21
+#endif
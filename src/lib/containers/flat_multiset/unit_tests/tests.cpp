@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <vector>
+
+#include "./../s21_flat_multiset.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+TEST(flatMultisetTest, DefaultConstructor) {
+    flat_multiset<int> s;
+    EXPECT_TRUE(s.empty());
+}
+
+TEST(flatMultisetTest, KeepsDuplicates) {
+    flat_multiset<int> s{3, 1, 3, 2, 3};
+    EXPECT_EQ(s.size(), (size_t) 5);
+    EXPECT_EQ(s.count(3), (size_t) 3);
+    EXPECT_EQ(s.count(4), (size_t) 0);
+    auto range = s.equal_range(3);
+    EXPECT_EQ(range.second - range.first, 3);
+    EXPECT_TRUE(range.second == s.end());
+}
+
+TEST(flatMultisetTest, EqualKeysKeepInsertionOrder) {
+    struct ByFirst {
+        bool operator()(const std::pair<int, int>& a, const std::pair<int, int>& b) const { return a.first < b.first; }
+    };
+    flat_multiset<std::pair<int, int>, ByFirst> s;
+    s.insert({1, 0});
+    s.insert({0, 0});
+    s.insert({1, 1});
+    std::vector<std::pair<int, int>> batch{{1, 2}, {0, 1}, {1, 3}};
+    s.insert_range(batch.begin(), batch.end());
+    std::vector<std::pair<int, int>> expected{{0, 0}, {0, 1}, {1, 0}, {1, 1}, {1, 2}, {1, 3}};
+    EXPECT_TRUE(std::equal(s.begin(), s.end(), expected.begin(), expected.end()));
+}
+
+TEST(flatMultisetTest, InsertRangeMatchesStdMultiset) {
+    std::mt19937 gen(3);
+    std::uniform_int_distribution<int> dist(0, 50);
+    flat_multiset<int> s;
+    std::multiset<int> expected;
+    for(int round = 0; round < 5; ++round) {
+        std::vector<int> batch;
+        for(int i = 0; i < 64; ++i) batch.push_back(dist(gen));
+        s.insert_range(batch.begin(), batch.end());
+        expected.insert(batch.begin(), batch.end());
+        int single = dist(gen);
+        s.insert(single);
+        expected.insert(single);
+        s.erase(s.find(*expected.rbegin()));
+        expected.erase(std::prev(expected.end()));
+    }
+    ASSERT_EQ(s.size(), expected.size());
+    EXPECT_TRUE(std::equal(s.begin(), s.end(), expected.begin()));
+}
+
+TEST(flatMultisetTest, HintedSearch) {
+    flat_multiset<int> s{1, 2, 2, 2, 3, 5, 5, 8};
+    EXPECT_TRUE(s.lower_bound(s.end(), 2) == s.begin() + 1);
+    EXPECT_TRUE(s.upper_bound(s.begin(), 2) == s.begin() + 4);
+    EXPECT_TRUE(s.find(s.begin() + 6, 5) == s.begin() + 5);
+    EXPECT_TRUE(s.find(s.begin(), 4) == s.end());
+}
+
+TEST(flatMultisetTest, MergeCopySwap) {
+    flat_multiset<int> a{1, 2};
+    flat_multiset<int> b{2, 3};
+    a.merge(b);
+    EXPECT_EQ(a.size(), (size_t) 4);
+    EXPECT_EQ(a.count(2), (size_t) 2);
+    flat_multiset<int> c(a);
+    EXPECT_TRUE(c == a);
+    c.swap(b);
+    EXPECT_TRUE(c.empty());
+    auto res = c.insert_many(7, 7);
+    EXPECT_TRUE(res[1].second);
+    EXPECT_EQ(c.count(7), (size_t) 2);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
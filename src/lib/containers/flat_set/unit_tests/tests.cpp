@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <vector>
+
+#include "./../s21_flat_set.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+TEST(flatSetTest, DefaultConstructor) {
+    flat_set<int> s;
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(s.size(), (size_t) 0);
+}
+
+TEST(flatSetTest, ListConstructor) {
+    flat_set<int> s{5, 3, 1, 3, 4, 5};
+    int ans[] = {1, 3, 4, 5};
+    int id = 0;
+    for(int value : s) EXPECT_EQ(value, ans[id++]);
+    EXPECT_EQ(id, 4);
+}
+
+TEST(flatSetTest, InsertEraseFind) {
+    flat_set<int> s;
+    for(int i = 10; i > 0; --i) EXPECT_TRUE(s.insert(i).second);
+    EXPECT_FALSE(s.insert(5).second);
+    EXPECT_EQ(*s.begin(), 1);
+    s.erase(s.find(5));
+    EXPECT_FALSE(s.contains(5));
+    EXPECT_EQ(*s.lower_bound(5), 6);
+    EXPECT_EQ(*s.upper_bound(6), 7);
+    s.erase(s.end());
+    EXPECT_EQ(s.size(), (size_t) 9);
+}
+
+TEST(flatSetTest, InsertRangeMatchesStdSet) {
+    flat_set<int> s{100, 50};
+    std::set<int> expected{100, 50};
+    std::vector<int> batch;
+    for(int i = 0; i < 300; ++i) batch.push_back((i * 7919) % 211);
+    s.insert_range(batch.begin(), batch.end());
+    expected.insert(batch.begin(), batch.end());
+    ASSERT_EQ(s.size(), expected.size());
+    EXPECT_TRUE(std::equal(s.begin(), s.end(), expected.begin()));
+    s.insert_range(batch.begin(), batch.begin());
+    EXPECT_EQ(s.size(), expected.size());
+}
+
+TEST(flatSetTest, GreaterCompare) {
+    flat_set<int, std::greater<int>> s{1, 2, 3};
+    EXPECT_EQ(*s.begin(), 3);
+    EXPECT_EQ(*s.lower_bound(2), 2);
+    EXPECT_EQ(*s.upper_bound(2), 1);
+}
+
+TEST(flatSetTest, HintedSearchFromAnyPosition) {
+    flat_set<int> s;
+    for(int i = 0; i < 256; i += 3) s.insert(i);
+    for(auto hint = s.begin();; ++hint) {
+        for(int key = -1; key < 260; key += 5) {
+            EXPECT_TRUE(s.lower_bound(hint, key) == s.lower_bound(key));
+            EXPECT_TRUE(s.upper_bound(hint, key) == s.upper_bound(key));
+        }
+        if(hint == s.end()) break;
+    }
+    EXPECT_EQ(*s.find(s.begin(), 30), 30);
+}
+
+TEST(flatSetTest, MergeAndSwap) {
+    flat_set<int> a{1, 2};
+    flat_set<int> b{2, 3};
+    a.merge(b);
+    EXPECT_EQ(a.size(), (size_t) 3);
+    EXPECT_TRUE(b.empty());
+    a.swap(b);
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(b.size(), (size_t) 3);
+    auto res = a.insert_many(4, 4, 1);
+    EXPECT_FALSE(res[1].second);
+    EXPECT_EQ(a.size(), (size_t) 2);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
@@ -0,0 +1,70 @@
+// Compares unordered_map against the ordered s21::map and std::unordered_map on point operations:
+// inserts, successful and failed lookups, and erases.
+//
+// Usage: bench_s21_hash_table [element_count]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "./../../map/s21_map.h"
+#include "./../../unordered_map/s21_unordered_map.h"
+
+namespace {
+    template <typename Body>
+    double measure(Body body) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(stop - start).count();
+    }
+
+    void report(const char* container, const char* phase, size_t ops, double seconds) {
+        std::printf("%-20s %-14s %10.2f Mops/s\n", container, phase, ops / seconds / 1e6);
+    }
+
+    template <typename Map>
+    void run(const char* container, const std::vector<int>& keys, const std::vector<int>& misses) {
+        const size_t n = keys.size();
+        Map table;
+        long long checksum = 0;
+
+        report(container, "insert", n, measure([&] {
+                   for(int key : keys) table.insert({key, key});
+               }));
+        report(container, "find hit", n, measure([&] {
+                   for(int key : keys) checksum += table.find(key)->second;
+               }));
+        report(container, "find miss", n, measure([&] {
+                   for(int key : misses) checksum += table.find(key) == table.end();
+               }));
+        report(container, "erase", n, measure([&] {
+                   for(int key : keys) table.erase(table.find(key));
+               }));
+
+        if(checksum == 42) std::printf("\n");
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    std::vector<int> keys(n);
+    std::vector<int> misses(n);
+    for(size_t i = 0; i < n; ++i) {
+        keys[i] = (int) (2 * i);
+        misses[i] = (int) (2 * i + 1);
+    }
+    std::mt19937 gen(42);
+    std::shuffle(keys.begin(), keys.end(), gen);
+    std::shuffle(misses.begin(), misses.end(), gen);
+
+    std::printf("Point operations, %zu int keys\n", n);
+    run<s21::unordered_map<int, int>>("s21::unordered_map", keys, misses);
+    run<std::unordered_map<int, int>>("std::unordered_map", keys, misses);
+    run<s21::map<int, int>>("s21::map", keys, misses);
+    return 0;
+}
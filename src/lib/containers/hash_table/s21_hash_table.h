@@ -0,0 +1,439 @@
+#ifndef S21_CONTAINERS_HASH_TABLE
+#define S21_CONTAINERS_HASH_TABLE
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define S21_HASH_TABLE_SSE2 1
+#endif
+
+namespace s21 {
+    // Open-addressing hash table in the Swiss-table layout: slots are grouped by 16, and every slot
+    // has a control byte holding either a state (empty/deleted) or 7 bits of its hash (H2). A lookup
+    // hashes once, jumps to a group chosen by the remaining bits (H1) and compares all 16 control
+    // bytes against H2 with one SSE2 instruction, so the key itself is compared only on a likely hit.
+    // Groups are probed quadratically and the search stops at the first group that has an empty slot.
+    //
+    // An erased slot becomes empty again when its group still has an empty slot: no probe can have
+    // passed through such a group. Only slots in full groups leave a tombstone, and tombstones are
+    // dropped on the next rehash. The load factor is kept at or below 7/8.
+    //
+    // TValue is the stored element: the key for sets, std::pair<const TKey, T> for maps. Lookups are
+    // templates so that transparent Hash/KeyEqual pairs can probe with another key type.
+    template <typename TKey, typename TValue, typename Hash = std::hash<TKey>, typename KeyEqual = std::equal_to<TKey>>
+    class HashTable {
+    public:
+        using key_type = TKey;
+        using value_type = TValue;
+        using size_type = size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+
+    private:
+        using ctrl_t = signed char;
+
+        static constexpr bool is_set = std::is_same_v<TKey, TValue>;
+        static constexpr ctrl_t kEmpty = -128;
+        static constexpr ctrl_t kDeleted = -2;
+        static constexpr size_type kGroupWidth = 16;
+        static constexpr std::align_val_t kCtrlAlign{16};
+
+        // 16 control bytes examined at once. Each match_* call returns a bitmask with bit i set when
+        // byte i matches.
+        class Group {
+        private:
+#ifdef S21_HASH_TABLE_SSE2
+            __m128i m_ctrl;
+
+        public:
+            explicit Group(const ctrl_t* ctrl) noexcept : m_ctrl(_mm_load_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+            uint32_t match(ctrl_t h2) const noexcept {
+                return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl)));
+            }
+
+            uint32_t match_empty() const noexcept { return match(kEmpty); }
+
+            // Empty and deleted are the only states below -1.
+            uint32_t match_empty_or_deleted() const noexcept {
+                return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), m_ctrl)));
+            }
+#else
+            const ctrl_t* m_ctrl;
+
+        public:
+            explicit Group(const ctrl_t* ctrl) noexcept : m_ctrl(ctrl) {}
+
+            uint32_t match(ctrl_t h2) const noexcept {
+                uint32_t mask = 0;
+                for(size_type i = 0; i < kGroupWidth; ++i) mask |= static_cast<uint32_t>(m_ctrl[i] == h2) << i;
+                return mask;
+            }
+
+            uint32_t match_empty() const noexcept { return match(kEmpty); }
+
+            uint32_t match_empty_or_deleted() const noexcept {
+                uint32_t mask = 0;
+                for(size_type i = 0; i < kGroupWidth; ++i) mask |= static_cast<uint32_t>(m_ctrl[i] < -1) << i;
+                return mask;
+            }
+#endif
+        };
+
+        ctrl_t* m_ctrl;
+        value_type* m_slots;
+        size_type m_capacity;
+        size_type m_size;
+        size_type m_growth_left;
+
+        static const key_type& key_of(const value_type& item) noexcept {
+            if constexpr(is_set) {
+                return item;
+            } else {
+                return item.first;
+            }
+        }
+
+        // std::hash is the identity for integers, so the bits are mixed before being split into H1/H2.
+        template <typename K>
+        static size_type hash_of(const K& key) noexcept(noexcept(Hash()(key))) {
+            uint64_t h = static_cast<uint64_t>(Hash()(key)) * 0x9E3779B97F4A7C15ull;
+            return static_cast<size_type>(h ^ (h >> 29));
+        }
+
+        static constexpr bool kNothrowRehash =
+            noexcept(hash_of(std::declval<const key_type&>())) && std::is_nothrow_move_constructible_v<value_type>;
+
+        static ctrl_t h2(size_type hash) noexcept { return static_cast<ctrl_t>(hash & 0x7F); }
+
+        static size_type max_load(size_type capacity) noexcept { return capacity - capacity / 8; }
+
+        size_type group_mask() const noexcept { return m_capacity / kGroupWidth - 1; }
+
+        static ctrl_t* allocate_ctrl(size_type capacity) {
+            ctrl_t* ctrl = static_cast<ctrl_t*>(::operator new(capacity, kCtrlAlign));
+            std::memset(ctrl, kEmpty, capacity);
+            return ctrl;
+        }
+
+        static void deallocate(ctrl_t* ctrl, value_type* slots, size_type capacity) noexcept {
+            if(capacity == 0) return;
+            ::operator delete(ctrl, kCtrlAlign);
+            std::allocator<value_type>().deallocate(slots, capacity);
+        }
+
+        void destroy_slots() noexcept {
+            if constexpr(!std::is_trivially_destructible_v<value_type>) {
+                for(size_type i = 0; i < m_capacity; ++i) {
+                    if(m_ctrl[i] >= 0) std::destroy_at(m_slots + i);
+                }
+            }
+        }
+
+        // First empty or deleted slot on the probe sequence of hash in a table of the given capacity.
+        static size_type find_free_slot(const ctrl_t* ctrl, size_type capacity, size_type hash) noexcept {
+            size_type mask = capacity / kGroupWidth - 1;
+            size_type group = (hash >> 7) & mask;
+            for(size_type step = 1;; ++step) {
+                uint32_t free = Group(ctrl + group * kGroupWidth).match_empty_or_deleted();
+                if(free) return group * kGroupWidth + std::countr_zero(free);
+                group = (group + step) & mask;
+            }
+        }
+
+        size_type find_free_slot(size_type hash) const noexcept { return find_free_slot(m_ctrl, m_capacity, hash); }
+
+        // The new table is built in locals and swapped in only once every element is in place, so a
+        // throwing allocation, hash or copy leaves the table as it was. When neither hashing nor moving
+        // can throw, elements are moved in one pass; otherwise every element is hashed and placed
+        // first, then copied, and the old elements are destroyed only after the last copy succeeds.
+        void resize(size_type new_capacity) {
+            value_type* new_slots = std::allocator<value_type>().allocate(new_capacity);
+            ctrl_t* new_ctrl;
+            try {
+                new_ctrl = allocate_ctrl(new_capacity);
+            } catch(...) {
+                std::allocator<value_type>().deallocate(new_slots, new_capacity);
+                throw;
+            }
+
+            if constexpr(kNothrowRehash) {
+                for(size_type i = 0; i < m_capacity; ++i) {
+                    if(m_ctrl[i] < 0) continue;
+                    size_type hash = hash_of(key_of(m_slots[i]));
+                    size_type index = find_free_slot(new_ctrl, new_capacity, hash);
+                    new_ctrl[index] = h2(hash);
+                    std::construct_at(new_slots + index, std::move(m_slots[i]));
+                    std::destroy_at(m_slots + i);
+                }
+            } else {
+                std::unique_ptr<size_type[]> target;
+                size_type built = 0;
+                try {
+                    target.reset(new size_type[m_size]);
+                    size_type placed = 0;
+                    for(size_type i = 0; i < m_capacity; ++i) {
+                        if(m_ctrl[i] < 0) continue;
+                        size_type hash = hash_of(key_of(m_slots[i]));
+                        size_type index = find_free_slot(new_ctrl, new_capacity, hash);
+                        new_ctrl[index] = h2(hash);
+                        target[placed++] = index;
+                    }
+                    for(size_type i = 0; i < m_capacity; ++i) {
+                        if(m_ctrl[i] < 0) continue;
+                        std::construct_at(new_slots + target[built], std::move_if_noexcept(m_slots[i]));
+                        ++built;
+                    }
+                } catch(...) {
+                    for(size_type i = 0; i < built; ++i) std::destroy_at(new_slots + target[i]);
+                    deallocate(new_ctrl, new_slots, new_capacity);
+                    throw;
+                }
+                destroy_slots();
+            }
+
+            deallocate(m_ctrl, m_slots, m_capacity);
+            m_ctrl = new_ctrl;
+            m_slots = new_slots;
+            m_capacity = new_capacity;
+            m_growth_left = max_load(new_capacity) - m_size;
+        }
+
+        // Called when no growth is left: a table that is mostly tombstones is rebuilt in place,
+        // anything else doubles.
+        void grow() {
+            if(m_capacity == 0) {
+                resize(kGroupWidth);
+            } else if(m_size * 2 <= max_load(m_capacity)) {
+                resize(m_capacity);
+            } else {
+                resize(m_capacity * 2);
+            }
+        }
+
+    public:
+        class HashIterator {
+            friend class HashTable;
+
+        private:
+            using reference_type = std::conditional_t<is_set, const value_type, value_type>;
+
+            const ctrl_t* m_ctrl;
+            value_type* m_slot;
+            const ctrl_t* m_end;
+
+            HashIterator(const ctrl_t* ctrl, value_type* slot, const ctrl_t* end) noexcept
+                : m_ctrl(ctrl), m_slot(slot), m_end(end) {}
+
+            void skip_free() noexcept {
+                while(m_ctrl != m_end && *m_ctrl < 0) {
+                    ++m_ctrl;
+                    ++m_slot;
+                }
+            }
+
+        public:
+            using reference = reference_type&;
+
+            HashIterator() noexcept : m_ctrl(nullptr), m_slot(nullptr), m_end(nullptr) {}
+
+            reference operator*() const noexcept { return *m_slot; }
+
+            reference_type* operator->() const noexcept { return m_slot; }
+
+            HashIterator& operator++() noexcept {
+                ++m_ctrl;
+                ++m_slot;
+                skip_free();
+                return *this;
+            }
+
+            HashIterator operator++(int) noexcept {
+                HashIterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            bool operator==(const HashIterator& other) const noexcept { return m_slot == other.m_slot; }
+
+            bool operator!=(const HashIterator& other) const noexcept { return m_slot != other.m_slot; }
+        };
+
+        using iterator = HashIterator;
+        using const_iterator = HashIterator;
+
+        HashTable() noexcept : m_ctrl(nullptr), m_slots(nullptr), m_capacity(0), m_size(0), m_growth_left(0) {}
+
+        // Keeps every element at its index and every tombstone in place, so the probe sequences of the
+        // copy are those of the original.
+        HashTable(const HashTable& other) : HashTable() {
+            if(other.m_size == 0) return;
+            ctrl_t* ctrl = allocate_ctrl(other.m_capacity);
+            try {
+                m_slots = std::allocator<value_type>().allocate(other.m_capacity);
+            } catch(...) {
+                ::operator delete(ctrl, kCtrlAlign);
+                throw;
+            }
+            m_ctrl = ctrl;
+            m_capacity = other.m_capacity;
+            for(size_type i = 0; i < m_capacity; ++i) {
+                if(other.m_ctrl[i] == kDeleted) {
+                    m_ctrl[i] = kDeleted;
+                } else if(other.m_ctrl[i] >= 0) {
+                    std::construct_at(m_slots + i, other.m_slots[i]);
+                    m_ctrl[i] = other.m_ctrl[i];
+                    ++m_size;
+                }
+            }
+            m_growth_left = other.m_growth_left;
+        }
+
+        HashTable(HashTable&& other) noexcept : HashTable() { swap(other); }
+
+        HashTable& operator=(const HashTable& other) {
+            if(this != &other) {
+                HashTable tmp(other);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        HashTable& operator=(HashTable&& other) noexcept {
+            if(this != &other) {
+                HashTable tmp(std::move(other));
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        ~HashTable() {
+            destroy_slots();
+            deallocate(m_ctrl, m_slots, m_capacity);
+        }
+
+        iterator begin() const noexcept {
+            iterator it(m_ctrl, m_slots, m_ctrl + m_capacity);
+            it.skip_free();
+            return it;
+        }
+
+        iterator end() const noexcept { return iterator(m_ctrl + m_capacity, m_slots + m_capacity, m_ctrl + m_capacity); }
+
+        size_type size() const noexcept { return m_size; }
+
+        bool empty() const noexcept { return m_size == 0; }
+
+        static size_type max_size() noexcept { return std::numeric_limits<size_type>::max() / sizeof(value_type); }
+
+        size_type bucket_count() const noexcept { return m_capacity; }
+
+        float load_factor() const noexcept { return m_capacity ? static_cast<float>(m_size) / m_capacity : 0.0f; }
+
+        // Makes room for count elements without further rehashing.
+        void reserve(size_type count) {
+            size_type capacity = kGroupWidth;
+            while(max_load(capacity) < count) capacity *= 2;
+            if(capacity > m_capacity) resize(capacity);
+        }
+
+        // Keeps the allocation; every slot becomes empty, tombstones included.
+        void clear() noexcept {
+            if(m_capacity == 0) return;
+            destroy_slots();
+            std::memset(m_ctrl, kEmpty, m_capacity);
+            m_size = 0;
+            m_growth_left = max_load(m_capacity);
+        }
+
+        void swap(HashTable& other) noexcept {
+            std::swap(m_ctrl, other.m_ctrl);
+            std::swap(m_slots, other.m_slots);
+            std::swap(m_capacity, other.m_capacity);
+            std::swap(m_size, other.m_size);
+            std::swap(m_growth_left, other.m_growth_left);
+        }
+
+        template <typename K>
+        iterator find(const K& key) const {
+            if(m_size == 0) return end();
+            size_type hash = hash_of(key);
+            size_type group = (hash >> 7) & group_mask();
+            for(size_type step = 1;; ++step) {
+                Group g(m_ctrl + group * kGroupWidth);
+                for(uint32_t mask = g.match(h2(hash)); mask; mask &= mask - 1) {
+                    size_type index = group * kGroupWidth + std::countr_zero(mask);
+                    if(KeyEqual()(key_of(m_slots[index]), key)) return iterator(m_ctrl + index, m_slots + index, m_ctrl + m_capacity);
+                }
+                if(g.match_empty()) return end();
+                group = (group + step) & group_mask();
+            }
+        }
+
+        template <typename K>
+        bool contains(const K& key) const {
+            return find(key) != end();
+        }
+
+        // Constructs value_type from args unless an element with an equal key is already present.
+        template <typename K, typename... Args>
+        std::pair<iterator, bool> emplace_unique(const K& key, Args&&... args) {
+            iterator it = find(key);
+            if(it != end()) return {it, false};
+
+            size_type hash = hash_of(key);
+            if(m_growth_left == 0) grow();
+            size_type index = find_free_slot(hash);
+            std::construct_at(m_slots + index, std::forward<Args>(args)...);
+            if(m_ctrl[index] == kEmpty) --m_growth_left;
+            m_ctrl[index] = h2(hash);
+            ++m_size;
+            return {iterator(m_ctrl + index, m_slots + index, m_ctrl + m_capacity), true};
+        }
+
+        // cppcheck-suppress passedByValue
+        void erase(iterator pos) noexcept {
+            if(pos.m_slot == nullptr || pos == end() || *pos.m_ctrl < 0) return;
+            size_type index = pos.m_slot - m_slots;
+            std::destroy_at(m_slots + index);
+            --m_size;
+            if(Group(m_ctrl + index / kGroupWidth * kGroupWidth).match_empty()) {
+                m_ctrl[index] = kEmpty;
+                ++m_growth_left;
+            } else {
+                m_ctrl[index] = kDeleted;
+            }
+        }
+
+        template <typename K>
+        size_type erase(const K& key) {
+            iterator it = find(key);
+            if(it == end()) return 0;
+            erase(it);
+            return 1;
+        }
+
+        bool operator==(const HashTable& other) const {
+            if(m_size != other.m_size) return false;
+            for(iterator it = begin(); it != end(); ++it) {
+                iterator match = other.find(key_of(*it));
+                if(match == other.end() || !(*match == *it)) return false;
+            }
+            return true;
+        }
+
+        bool operator!=(const HashTable& other) const { return !(*this == other); }
+    };
+} // namespace s21
+
+#endif
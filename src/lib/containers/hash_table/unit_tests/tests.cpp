@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+
+#include "./../s21_hash_table.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+namespace {
+    // Sends every key to the same group so that probing past full groups is exercised.
+    struct CollidingHash {
+        size_t operator()(int) const { return 0; }
+    };
+
+    using IntTable = HashTable<int, int>;
+
+    // Key whose copy throws once a countdown reaches zero; it has no move constructor, so a rehash
+    // has to copy it.
+    struct ThrowingKey {
+        static inline int copies_left = -1;
+        int value;
+
+        explicit ThrowingKey(int v) : value(v) {}
+
+        ThrowingKey(const ThrowingKey& other) : value(other.value) {
+            if(copies_left == 0) throw std::runtime_error("copy");
+            if(copies_left > 0) --copies_left;
+        }
+
+        bool operator==(const ThrowingKey& other) const { return value == other.value; }
+    };
+
+    struct ThrowingKeyHash {
+        size_t operator()(const ThrowingKey& key) const { return std::hash<int>()(key.value); }
+    };
+} // namespace
+
+TEST(HashTableTest, EmptyTable) {
+    IntTable table;
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.bucket_count(), (size_t) 0);
+    EXPECT_TRUE(table.begin() == table.end());
+    EXPECT_TRUE(table.find(1) == table.end());
+    EXPECT_EQ(table.erase(1), (size_t) 0);
+}
+
+TEST(HashTableTest, GrowsAtSevenEighths) {
+    IntTable table;
+    for(int i = 0; i < 14; ++i) table.emplace_unique(i, i);
+    EXPECT_EQ(table.bucket_count(), (size_t) 16);
+    table.emplace_unique(14, 14);
+    EXPECT_EQ(table.bucket_count(), (size_t) 32);
+    for(int i = 0; i < 15; ++i) EXPECT_TRUE(table.contains(i));
+}
+
+TEST(HashTableTest, RejectsDuplicates) {
+    IntTable table;
+    EXPECT_TRUE(table.emplace_unique(7, 7).second);
+    auto res = table.emplace_unique(7, 7);
+    EXPECT_FALSE(res.second);
+    EXPECT_EQ(*res.first, 7);
+    EXPECT_EQ(table.size(), (size_t) 1);
+}
+
+TEST(HashTableTest, ProbesPastFullGroups) {
+    HashTable<int, int, CollidingHash> table;
+    for(int i = 0; i < 100; ++i) table.emplace_unique(i, i);
+    EXPECT_EQ(table.size(), (size_t) 100);
+    for(int i = 0; i < 100; ++i) EXPECT_TRUE(table.contains(i));
+    EXPECT_FALSE(table.contains(100));
+    for(int i = 0; i < 100; i += 2) EXPECT_EQ(table.erase(i), (size_t) 1);
+    for(int i = 0; i < 100; ++i) EXPECT_EQ(table.contains(i), i % 2 == 1);
+    for(int i = 0; i < 100; i += 2) EXPECT_TRUE(table.emplace_unique(i, i).second);
+    EXPECT_EQ(table.size(), (size_t) 100);
+}
+
+TEST(HashTableTest, ChurnKeepsCapacityBounded) {
+    IntTable table;
+    table.reserve(100);
+    size_t capacity = table.bucket_count();
+    for(int round = 0; round < 1000; ++round) {
+        for(int i = 0; i < 50; ++i) table.emplace_unique(round * 50 + i, round * 50 + i);
+        for(int i = 0; i < 50; ++i) table.erase(round * 50 + i);
+    }
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.bucket_count(), capacity);
+}
+
+TEST(HashTableTest, RandomWorkloadMatchesStd) {
+    std::mt19937 gen(11);
+    std::uniform_int_distribution<int> dist(0, 2000);
+    IntTable table;
+    std::unordered_set<int> expected;
+    for(int i = 0; i < 20000; ++i) {
+        int key = dist(gen);
+        if(gen() % 3 == 0) {
+            EXPECT_EQ(table.erase(key), expected.erase(key));
+        } else {
+            EXPECT_EQ(table.emplace_unique(key, key).second, expected.insert(key).second);
+        }
+    }
+    EXPECT_EQ(table.size(), expected.size());
+    size_t visited = 0;
+    for(int key : table) {
+        EXPECT_TRUE(expected.count(key));
+        ++visited;
+    }
+    EXPECT_EQ(visited, expected.size());
+}
+
+TEST(HashTableTest, CopyMoveClear) {
+    HashTable<std::string, std::pair<const std::string, int>> table;
+    for(int i = 0; i < 40; ++i) table.emplace_unique(std::to_string(i), std::to_string(i), i);
+    auto copy = table;
+    EXPECT_TRUE(copy == table);
+    auto moved = std::move(copy);
+    EXPECT_TRUE(moved == table);
+    EXPECT_TRUE(copy.empty());
+    size_t capacity = moved.bucket_count();
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+    EXPECT_EQ(moved.bucket_count(), capacity);
+    EXPECT_TRUE(moved.begin() == moved.end());
+    EXPECT_FALSE(moved == table);
+}
+
+TEST(HashTableTest, CopyKeepsTombstones) {
+    HashTable<int, int, CollidingHash> table;
+    table.reserve(20);
+    EXPECT_EQ(table.bucket_count(), (size_t) 32);
+    for(int i = 0; i < 20; ++i) table.emplace_unique(i, i);
+    EXPECT_EQ(table.erase(0), (size_t) 1);
+    auto copy = table;
+    EXPECT_EQ(copy.size(), (size_t) 19);
+    for(int i = 1; i < 20; ++i) EXPECT_TRUE(copy.contains(i));
+    EXPECT_FALSE(copy.contains(0));
+    EXPECT_TRUE(copy == table);
+    for(int i = 20; i < 28; ++i) EXPECT_TRUE(copy.emplace_unique(i, i).second);
+    for(int i = 1; i < 28; ++i) EXPECT_TRUE(copy.contains(i));
+}
+
+TEST(HashTableTest, ThrowDuringRehashKeepsTable) {
+    HashTable<ThrowingKey, ThrowingKey, ThrowingKeyHash> table;
+    for(int i = 0; i < 14; ++i) table.emplace_unique(ThrowingKey(i), i);
+    EXPECT_EQ(table.bucket_count(), (size_t) 16);
+    ThrowingKey::copies_left = 3;
+    EXPECT_THROW(table.emplace_unique(ThrowingKey(14), 14), std::runtime_error);
+    ThrowingKey::copies_left = -1;
+    EXPECT_EQ(table.size(), (size_t) 14);
+    EXPECT_EQ(table.bucket_count(), (size_t) 16);
+    size_t visited = 0;
+    for(auto it = table.begin(); it != table.end(); ++it) ++visited;
+    EXPECT_EQ(visited, (size_t) 14);
+    for(int i = 0; i < 14; ++i) EXPECT_TRUE(table.contains(ThrowingKey(i)));
+    EXPECT_TRUE(table.emplace_unique(ThrowingKey(14), 14).second);
+    EXPECT_EQ(table.bucket_count(), (size_t) 32);
+    for(int i = 0; i < 15; ++i) EXPECT_TRUE(table.contains(ThrowingKey(i)));
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
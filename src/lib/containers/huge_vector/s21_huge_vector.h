@@ -0,0 +1,106 @@
+#ifndef S21_CONTAINERS_HUGE_VECTOR
+#define S21_CONTAINERS_HUGE_VECTOR
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#include "./../vector/s21_vector.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define S21_HUGE_VECTOR_MMAP 1
+#endif
+
+namespace s21 {
+#ifdef S21_HUGE_VECTOR_MMAP
+    // Allocates whole pages straight from the kernel with anonymous mmap. Its reallocate() resizes a
+    // block with mremap(MREMAP_MAYMOVE): growing remaps the existing pages to a larger range instead
+    // of copying them, and shrinking unmaps the pages past the new end. With HugePages the blocks are
+    // marked MADV_HUGEPAGE so that transparent huge pages can back them, which cuts TLB misses on
+    // multi-gigabyte buffers. The advice is best effort and silently ignored where THP is disabled.
+    template <typename T, bool HugePages = false>
+    class mmap_allocator {
+        static_assert(alignof(T) <= 4096, "mmap_allocator hands out page-aligned memory only");
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using is_always_equal = std::true_type;
+
+        template <typename U>
+        struct rebind {
+            using other = mmap_allocator<U, HugePages>;
+        };
+
+        mmap_allocator() noexcept = default;
+
+        // cppcheck-suppress noExplicitConstructor
+        template <typename U>
+        mmap_allocator(const mmap_allocator<U, HugePages>&) noexcept {}
+
+        T* allocate(size_type count) {
+            size_t length = bytes(count);
+            void* data = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if(data == MAP_FAILED) throw std::bad_alloc();
+            advise(data, length);
+            return static_cast<T*>(data);
+        }
+
+        void deallocate(T* data, size_type count) noexcept {
+            if(data != nullptr) munmap(data, bytes(count));
+        }
+
+        // Resizes the block at data from old_count to new_count elements. The contents move along
+        // with the pages, so this only suits trivially relocatable element types.
+        T* reallocate(T* data, size_type old_count, size_type new_count) {
+            size_t old_length = bytes(old_count);
+            size_t new_length = bytes(new_count);
+            if(old_length == new_length) return data;
+            void* moved = mremap(data, old_length, new_length, MREMAP_MAYMOVE);
+            if(moved == MAP_FAILED) throw std::bad_alloc();
+            if(new_length > old_length) advise(moved, new_length);
+            return static_cast<T*>(moved);
+        }
+
+        static size_t page_size() noexcept {
+            static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            return size;
+        }
+
+        template <typename U>
+        bool operator==(const mmap_allocator<U, HugePages>&) const noexcept {
+            return true;
+        }
+
+    private:
+        static size_t bytes(size_type count) noexcept {
+            size_t page = page_size();
+            return (count * sizeof(T) + page - 1) / page * page;
+        }
+
+        static void advise([[maybe_unused]] void* data, [[maybe_unused]] size_t length) noexcept {
+#ifdef MADV_HUGEPAGE
+            if constexpr(HugePages) madvise(data, length, MADV_HUGEPAGE);
+#endif
+        }
+    };
+
+    // A vector for multi-gigabyte buffers of trivially relocatable data. Storage comes from
+    // mmap_allocator, so growth and shrink_to_fit remap pages and never copy elements. Capacity
+    // grows in whole pages, or in 2 MiB steps once the buffer is large when HugePages is set.
+    template <typename T, bool HugePages = true>
+        requires is_trivially_relocatable_v<T>
+    using huge_vector = vector<T, mmap_allocator<T, HugePages>, 0,
+                               std::conditional_t<HugePages, hugepage_aligned_growth, page_aligned_growth<0>>>;
+#else
+    // Without mremap, huge_vector falls back to malloc storage: vector grows relocatable elements
+    // with realloc, which large-block allocators usually serve by remapping as well.
+    template <typename T, bool HugePages = true>
+        requires is_trivially_relocatable_v<T>
+    using huge_vector = vector<T, std::allocator<T>, 0, page_aligned_growth<>>;
+#endif
+} // namespace s21
+
+#endif
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+#include "./../s21_huge_vector.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+#ifdef S21_HUGE_VECTOR_MMAP
+namespace {
+    // mmap_allocator that counts how the vector uses it.
+    struct CountingMmapAllocator : mmap_allocator<uint64_t, false> {
+        static inline size_t allocations = 0;
+        static inline size_t reallocations = 0;
+
+        uint64_t* allocate(size_t count) {
+            ++allocations;
+            return mmap_allocator::allocate(count);
+        }
+
+        uint64_t* reallocate(uint64_t* data, size_t old_count, size_t new_count) {
+            ++reallocations;
+            return mmap_allocator::reallocate(data, old_count, new_count);
+        }
+    };
+} // namespace
+
+TEST(hugeVectorTest, GrowsByRemapping) {
+    CountingMmapAllocator::allocations = 0;
+    CountingMmapAllocator::reallocations = 0;
+    s21::vector<uint64_t, CountingMmapAllocator> v;
+    for(uint64_t i = 0; i < 1000000; ++i) v.push_back(i * 3);
+    EXPECT_EQ(CountingMmapAllocator::allocations, (size_t) 1);
+    EXPECT_GT(CountingMmapAllocator::reallocations, (size_t) 10);
+    for(uint64_t i = 0; i < 1000000; i += 997) ASSERT_EQ(v[i], i * 3);
+}
+
+TEST(hugeVectorTest, MmapAllocatorHoldsNonRelocatableTypes) {
+    s21::vector<std::string, mmap_allocator<std::string>> v;
+    for(int i = 0; i < 1000; ++i) v.push_back(std::string(40, static_cast<char>('a' + i % 26)));
+    EXPECT_EQ(v.at(999), std::string(40, 'a' + 999 % 26));
+    v.erase(v.begin());
+    EXPECT_EQ(v.at(0), std::string(40, 'b'));
+}
+#endif
+
+TEST(hugeVectorTest, CapacityFillsPages) {
+    huge_vector<uint32_t, false> v;
+    v.push_back(7);
+    EXPECT_EQ(v.capacity() * sizeof(uint32_t) % 4096, (size_t) 0);
+    for(uint32_t i = 0; i < 100000; ++i) v.push_back(i);
+    EXPECT_EQ(v.capacity() * sizeof(uint32_t) % 4096, (size_t) 0);
+    EXPECT_EQ(v.at(0), (uint32_t) 7);
+    EXPECT_EQ(v.at(100000), (uint32_t) 99999);
+}
+
+TEST(hugeVectorTest, ShrinkToFitKeepsData) {
+    huge_vector<double> v;
+    for(int i = 0; i < 3000000; ++i) v.push_back(i * 0.5);
+    while(v.size() > 1000) v.pop_back();
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), (size_t) 1000);
+    EXPECT_EQ(v.at(999), 999 * 0.5);
+    v.clear();
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), (size_t) 0);
+}
+
+TEST(hugeVectorTest, InsertAndEraseShiftBytes) {
+    huge_vector<int> v;
+    for(int i = 0; i < 10; ++i) v.push_back(i);
+    v.insert(v.begin(), -1);
+    v.erase(v.begin() + 5);
+    EXPECT_EQ(v.size(), (size_t) 10);
+    EXPECT_EQ(v.at(0), -1);
+    EXPECT_EQ(v.at(5), 5);
+    huge_vector<int> other(std::move(v));
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(other.at(9), 9);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
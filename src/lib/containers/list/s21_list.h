@@ -4,31 +4,46 @@
 #include <algorithm>
 #include <cstdio>
 #include <limits>
+#include <memory>
+#include <memory_resource>
 #include <new>
 #include <stdexcept>
+#include <utility>
 
 #include "./../array/s21_array.h"
+#include "./../common/s21_access.h"
 
 namespace s21 {
 
-    template <typename T>
+    // Nodes come from Allocator rebound to the node type; element values are built with
+    // allocator_traits::construct on the original allocator, so pmr allocators reach the elements.
+    template <typename T, typename Allocator = std::allocator<T>>
     class list {
     public:
         using value_type = T;
+        using allocator_type = Allocator;
         using reference = T&;
         using const_reference = const T&;
         using size_type = size_t;
 
     private:
+        // The value lives in a union so that the end sentinel can leave it unconstructed.
         struct m_Node {
-            value_type data;
             m_Node* next;
             m_Node* prev;
 
-            explicit m_Node(const value_type& val = value_type(), m_Node* n = nullptr, m_Node* p = nullptr) :
-                data(val), next(n), prev(p) {}
+            union {
+                value_type data;
+            };
+
+            m_Node(m_Node* n, m_Node* p) : next(n), prev(p) {}
+            ~m_Node() {}
         };
 
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using node_allocator = typename alloc_traits::template rebind_alloc<m_Node>;
+        using node_traits = std::allocator_traits<node_allocator>;
+
         class ListIterator {
         protected:
             m_Node* ptr;
@@ -40,7 +55,7 @@ namespace s21 {
             virtual ~ListIterator() = default;
 
             reference operator*() {
-                if(ptr == nullptr) throw std::out_of_range("List is empty to deref anything from it");
+                check_access(ptr != nullptr, "List is empty to deref anything from it");
                 return ptr->data;
             }
 
@@ -134,31 +149,81 @@ namespace s21 {
         m_Node* m_tail;
         m_Node* m_end;
         size_type m_size;
+        [[no_unique_address]] Allocator m_alloc;
+
+        m_Node* allocate_node(m_Node* next, m_Node* prev) {
+            node_allocator nodes(m_alloc);
+            m_Node* node = node_traits::allocate(nodes, 1);
+            return std::construct_at(node, next, prev);
+        }
+
+        void deallocate_node(const m_Node* node) noexcept {
+            node_allocator nodes(m_alloc);
+            node_traits::deallocate(nodes, const_cast<m_Node*>(node), 1);
+        }
+
+        template <typename... Args>
+        m_Node* create_node(m_Node* next, m_Node* prev, Args&&... args) {
+            m_Node* node = allocate_node(next, prev);
+            try {
+                alloc_traits::construct(m_alloc, std::addressof(node->data), std::forward<Args>(args)...);
+            }
+            catch(...) {
+                deallocate_node(node);
+                throw;
+            }
+            return node;
+        }
+
+        void destroy_node(const m_Node* node) noexcept {
+            alloc_traits::destroy(m_alloc, std::addressof(const_cast<m_Node*>(node)->data));
+            deallocate_node(node);
+        }
+
+        void steal(list& other) noexcept {
+            m_head = other.m_head;
+            m_tail = other.m_tail;
+            m_end = other.m_end;
+            m_size = other.m_size;
+            other.m_head = nullptr;
+            other.m_tail = nullptr;
+            other.m_end = nullptr;
+            other.m_size = 0;
+        }
 
     public:
-        list() : m_head(nullptr), m_tail(nullptr), m_end(nullptr), m_size(0) {}
+        list() : list(Allocator()) {}
+
+        explicit list(const Allocator& alloc) : m_head(nullptr), m_tail(nullptr), m_end(nullptr), m_size(0), m_alloc(alloc) {}
 
-        explicit list(size_type n) : list() {
+        explicit list(size_type n, const Allocator& alloc = Allocator()) : list(alloc) {
             for(size_type i = 0; i < n; ++i) { push_back(value_type()); }
         }
 
-        explicit list(std::initializer_list<value_type> const& items) : list() {
+        explicit list(std::initializer_list<value_type> const& items, const Allocator& alloc = Allocator()) : list(alloc) {
             for(const value_type& item : items) { push_back(item); }
         }
 
-        list(const list& other) : list() {
+        list(const list& other) : list(other, alloc_traits::select_on_container_copy_construction(other.m_alloc)) {}
+
+        list(const list& other, const Allocator& alloc) : list(alloc) {
             for(iterator it = other.m_head; it != other.m_end; ++it) { push_back(*it); }
         }
 
-        list(list&& other) noexcept : m_head(other.m_head), m_tail(other.m_tail), m_size(other.m_size), m_end(other.m_end) {
-            other.m_head = nullptr;
-            other.m_end = nullptr;
-            other.m_tail = nullptr;
-            other.m_size = 0;
+        list(list&& other) noexcept : list(std::move(other.m_alloc)) { steal(other); }
+
+        list(list&& other, const Allocator& alloc) : list(alloc) {
+            if(m_alloc == other.m_alloc) {
+                steal(other);
+            } else {
+                for(iterator it = other.m_head; it != other.m_end; ++it) { push_back(*it); }
+            }
         }
 
         ~list() { clear(); }
 
+        allocator_type get_allocator() const noexcept { return m_alloc; }
+
         list& operator=(const list& other) {
             if(this != &other) {
                 list tmp(other);
@@ -167,23 +232,29 @@ namespace s21 {
             return *this;
         }
 
-        list& operator=(list&& other) noexcept {
+        list& operator=(list&& other) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                               alloc_traits::is_always_equal::value) {
             if(this != &other) {
                 clear();
-                m_head = other.m_head;
-                m_tail = other.m_tail;
-                m_end = other.m_end;
-                m_size = other.m_size;
-                other.m_head = nullptr;
-                other.m_tail = nullptr;
-                other.m_end = nullptr;
-                other.m_size = 0;
+                if constexpr(alloc_traits::propagate_on_container_move_assignment::value) m_alloc = std::move(other.m_alloc);
+                if(m_alloc == other.m_alloc) {
+                    steal(other);
+                } else {
+                    for(iterator it = other.m_head; it != other.m_end; ++it) { push_back(*it); }
+                    other.clear();
+                }
             }
             return *this;
         }
 
-        const_reference front() const { return m_head->data; }
-        const_reference back() const { return m_tail->data; }
+        const_reference front() const {
+            check_access(m_size > 0, "List is empty");
+            return m_head->data;
+        }
+        const_reference back() const {
+            check_access(m_size > 0, "List is empty");
+            return m_tail->data;
+        }
 
         iterator begin() noexcept { return iterator(m_head); }
         iterator end() noexcept { return iterator(m_end); }
@@ -209,7 +280,7 @@ namespace s21 {
                 return iterator(m_tail);
             } else {
                 m_Node* current = pos.get_node();
-                m_Node* new_node = new m_Node(value, current, current->prev);
+                m_Node* new_node = create_node(current, current->prev, value);
                 current->prev->next = new_node;
                 current->prev = new_node;
                 ++m_size;
@@ -230,21 +301,30 @@ namespace s21 {
             } else {
                 current->prev->next = current->next;
                 current->next->prev = current->prev;
-                delete current;
+                destroy_node(current);
                 --m_size;
             }
         }
 
         // cppcheck-suppress passedByValue
         void push_back(const_reference value) {
-            auto* new_node = new m_Node(value, m_end, m_tail);
+            if(empty()) { m_end = allocate_node(nullptr, nullptr); }
+            m_Node* new_node;
+            try {
+                new_node = create_node(m_end, m_tail, value);
+            }
+            catch(...) {
+                if(empty()) {
+                    deallocate_node(m_end);
+                    m_end = nullptr;
+                }
+                throw;
+            }
 
             if(empty()) {
                 m_head = new_node;
                 m_tail = new_node;
-                m_end = new m_Node(T(), nullptr, new_node);
-                if(nullptr == m_end) throw std::bad_alloc();
-                new_node->next = m_end;
+                m_end->prev = new_node;
             } else {
                 m_tail->next = new_node;
                 m_tail = new_node;
@@ -256,8 +336,16 @@ namespace s21 {
 
         // cppcheck-suppress passedByValue
         void push_front(const_reference value) {
-            m_Node* new_node = new m_Node(value, m_head, nullptr);
-            if(empty()) { m_end = new m_Node(T(), nullptr, new_node); }
+            m_Node* new_node = create_node(m_head, nullptr, value);
+            if(empty()) {
+                try {
+                    m_end = allocate_node(nullptr, new_node);
+                }
+                catch(...) {
+                    destroy_node(new_node);
+                    throw;
+                }
+            }
             if(m_head) {
                 m_head->prev = new_node;
             } else {
@@ -276,9 +364,12 @@ namespace s21 {
             m_tail = m_tail->prev;
             m_end->prev = m_tail;
             if(m_size == 1) { m_head = nullptr; }
-            delete temp;
+            destroy_node(temp);
             --m_size;
-            if(m_size == 0) { delete m_end; }
+            if(m_size == 0) {
+                deallocate_node(m_end);
+                m_end = nullptr;
+            }
         }
 
         void pop_front() {
@@ -287,12 +378,17 @@ namespace s21 {
             const m_Node* temp = m_head;
             m_head = m_head->next;
             if(!m_head) { m_tail = nullptr; }
-            delete temp;
+            destroy_node(temp);
             --m_size;
-            if(m_size == 0) { delete m_end; }
+            if(m_size == 0) {
+                deallocate_node(m_end);
+                m_end = nullptr;
+            }
         }
 
+        // Allocators are exchanged only when they propagate on swap; otherwise they must be equal.
         void swap(list& other) noexcept {
+            if constexpr(alloc_traits::propagate_on_container_swap::value) std::swap(m_alloc, other.m_alloc);
             std::swap(m_head, other.m_head);
             std::swap(m_tail, other.m_tail);
             std::swap(m_end, other.m_end);
@@ -327,7 +423,7 @@ namespace s21 {
             other.m_head = other.m_tail = nullptr;
             other.m_size = 0;
 
-            delete other.m_end;
+            other.deallocate_node(other.m_end);
             other.m_end = nullptr;
         }
 
@@ -414,6 +510,12 @@ namespace s21 {
         };
     };
 
+    // Lists whose nodes come from a std::pmr::memory_resource.
+    namespace pmr {
+        template <typename T>
+        using list = s21::list<T, std::pmr::polymorphic_allocator<T>>;
+    } // namespace pmr
+
 } // namespace s21
 
 #endif
@@ -4,9 +4,12 @@
 #include <gtest/gtest.h>
 
 #include <cstdio>
+#include <memory_resource>
 #include <stdexcept>
+#include <string>
 
 #include "./../s21_list.h"
+#include "./../testing_include/counting_resource.h"
 #include "./../testing_include/test_include.h"
 
 using namespace s21;
@@ -193,9 +196,11 @@ TEST(ListTest, IteratorTest) {
 TEST(ListTest, IteratorDereferenceOnEmptyList) {
     list<int> list1;
 
+#if S21_CHECKED_ACCESS
     auto it = list1.begin();
     EXPECT_THROW(*it, std::out_of_range); // Разыменование на пустом списке
                                           // должно вызвать исключение
+#endif
 }
 
 // Тест для const_iterator
@@ -592,6 +597,21 @@ TEST(ListTest, InsertManyFront) {
     EXPECT_EQ(list2[2], 6);
 }
 
+TEST(ListTest, PmrListAllocatesNodesFromResource) {
+    CountingResource resource;
+    {
+        s21::pmr::list<std::pmr::string> l(&resource);
+        l.push_back(std::pmr::string(std::string(64, 'x')));
+        l.push_front(std::pmr::string(std::string(64, 'y')));
+        EXPECT_EQ(l.front().get_allocator().resource(), &resource);
+        EXPECT_GE(resource.allocations, (size_t) 5);
+        s21::pmr::list<std::pmr::string> moved(std::move(l));
+        EXPECT_EQ(moved.size(), (size_t) 2);
+        EXPECT_EQ(moved.get_allocator().resource(), &resource);
+    }
+    EXPECT_EQ(resource.live_bytes, (size_t) 0);
+}
+
 int main(int argc, char** argv) {
     testing::InitGoogleTest(&argc, argv);
     UTIL(RUN_ALL_TESTS());
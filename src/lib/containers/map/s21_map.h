@@ -2,28 +2,34 @@
 #define S21_CONTAINERS_MAP
 
 #include <functional>
+#include <memory_resource>
 
 #include "./../tree/s21_tree.h"
 #include "./../vector/s21_vector.h"
 
 namespace s21 {
-    template <typename TKey, typename TValue, typename Compare = std::less<TKey>>
+    template <typename TKey, typename TValue, typename Compare = std::less<TKey>, typename Balance = red_black_balance,
+              bool Threaded = false, typename Allocator = std::allocator<std::pair<const TKey, TValue>>>
     class map {
     private:
-        BinaryTree<TKey, TValue, Compare, std::pair<const TKey, TValue>> m_tree;
+        BinaryTree<TKey, TValue, Compare, std::pair<const TKey, TValue>, Balance, Threaded, Allocator> m_tree;
 
     public:
         using key_type = TKey;
         using mapped_type = TValue;
+        using key_compare = Compare;
         using value_type = std::pair<const key_type, mapped_type>;
         using reference = value_type&;
         using const_reference = const value_type&;
-        using iterator = typename BinaryTree<TKey, TValue, Compare, value_type>::iterator;
-        using const_iterator = typename BinaryTree<TKey, TValue, Compare, value_type>::const_iterator;
+        using iterator = typename BinaryTree<TKey, TValue, Compare, value_type, Balance, Threaded, Allocator>::iterator;
+        using const_iterator = typename BinaryTree<TKey, TValue, Compare, value_type, Balance, Threaded, Allocator>::const_iterator;
         using size_type = size_t;
+        using allocator_type = Allocator;
 
         map() = default;
 
+        explicit map(const Allocator& alloc) : m_tree(alloc) {}
+
         explicit map(std::initializer_list<value_type> const& list) {
             for(const auto& value : list) insert(value);
         }
@@ -60,6 +66,7 @@ namespace s21 {
         size_type size() const { return m_tree.size(); }
         size_type max_size() const { return m_tree.max_size(); }
         void clear() { m_tree.clear(); }
+        allocator_type get_allocator() const noexcept { return m_tree.get_allocator(); }
 
         std::pair<iterator, bool> insert(const value_type& value) { return m_tree.insert_unique(value.first, value.second); }
 
@@ -84,6 +91,17 @@ namespace s21 {
         iterator find(const key_type& key) const { return m_tree.find(key); }
         bool contains(const key_type& key) const { return m_tree.contains(key); }
 
+        iterator lower_bound(const key_type& key) const { return m_tree.lower_bound(key); }
+        iterator upper_bound(const key_type& key) const { return m_tree.upper_bound(key); }
+
+        // Finger search: start from an iterator close to the key instead of the root.
+        // cppcheck-suppress passedByValue
+        iterator find(iterator from, const key_type& key) const { return m_tree.find(from, key); }
+        // cppcheck-suppress passedByValue
+        iterator lower_bound(iterator from, const key_type& key) const { return m_tree.lower_bound(from, key); }
+        // cppcheck-suppress passedByValue
+        iterator upper_bound(iterator from, const key_type& key) const { return m_tree.upper_bound(from, key); }
+
         template <typename... Args>
         s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
             s21::vector<std::pair<iterator, bool>> result;
@@ -92,5 +110,12 @@ namespace s21 {
             return result;
         }
     };
+
+    // Maps whose nodes, keys and values share one std::pmr::memory_resource.
+    namespace pmr {
+        template <typename TKey, typename TValue, typename Compare = std::less<TKey>, typename Balance = red_black_balance,
+                  bool Threaded = false>
+        using map = s21::map<TKey, TValue, Compare, Balance, Threaded, std::pmr::polymorphic_allocator<std::pair<const TKey, TValue>>>;
+    } // namespace pmr
 } // namespace s21
 #endif
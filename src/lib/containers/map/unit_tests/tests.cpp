@@ -3,7 +3,11 @@
 //
 #include <gtest/gtest.h>
 
+#include <memory_resource>
+#include <string>
+
 #include "./../s21_map.h"
+#include "./../testing_include/counting_resource.h"
 #include "./../testing_include/test_include.h"
 
 using namespace s21;
@@ -309,6 +313,46 @@ TEST(mapTest, InsertMany) {
     for(auto it = m.begin(); it != m.end(); ++it) { EXPECT_EQ((*it).second, ans[ans_id++]); }
 }
 
+TEST(mapTest, ThreadedMode) {
+    map<int, int, std::less<int>, red_black_balance, true> m{{3, 30}, {1, 10}, {2, 20}};
+    m.insert(4, 40);
+    m.erase(m.find(2));
+    int ans[] = {1, 3, 4};
+    int ans_id = 0;
+    for(auto it = m.begin(); it != m.end(); ++it) { EXPECT_EQ((*it).first, ans[ans_id++]); }
+    EXPECT_EQ(ans_id, 3);
+}
+
+TEST(mapTest, FingerSearch) {
+    map<int, int> m;
+    for(int i = 0; i < 100; i += 2) { m.insert(i, i * 10); }
+    auto it = m.lower_bound(41);
+    EXPECT_EQ((*it).first, 42);
+    it = m.find(it, 48);
+    EXPECT_EQ((*it).second, 480);
+    it = m.lower_bound(it, 49);
+    EXPECT_EQ((*it).first, 50);
+    EXPECT_EQ((*m.upper_bound(it, 50)).first, 52);
+    EXPECT_TRUE(m.find(it, 51) == m.end());
+    EXPECT_EQ((*m.lower_bound(it, 3)).first, 4);
+}
+
+TEST(mapTest, PmrMapAllocatesNodesAndValuesFromResource) {
+    CountingResource resource;
+    {
+        s21::pmr::map<int, std::pmr::string> m(&resource);
+        for(int i = 0; i < 10; ++i) m.insert(i, std::pmr::string(std::string(40, 'a' + i)));
+        EXPECT_EQ(m.at(3).get_allocator().resource(), &resource);
+        EXPECT_GE(resource.allocations, (size_t) 21);
+        m.erase(m.find(3));
+        EXPECT_FALSE(m.contains(3));
+        s21::pmr::map<int, std::pmr::string> moved(std::move(m));
+        EXPECT_EQ(moved.size(), (size_t) 9);
+        EXPECT_EQ(moved.get_allocator().resource(), &resource);
+    }
+    EXPECT_EQ(resource.live_bytes, (size_t) 0);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     UTIL(RUN_ALL_TESTS());
@@ -0,0 +1,82 @@
+// Saving and restoring an array of fixed-size records: writing them element by element to a stream
+// and parsing them back into an s21::vector, against a mapped_vector that is reopened read-only.
+// The parse is O(n); reopening maps the file and is O(1) until the records are touched, so the
+// last line also times a full scan over the mapped records (served from the page cache here).
+//
+// Usage: bench_s21_mapped_vector [record_count] [directory]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#include "./../../vector/s21_vector.h"
+#include "./../s21_mapped_vector.h"
+
+namespace {
+    struct Record {
+        uint64_t id;
+        double price;
+        int32_t quantity;
+    };
+
+    template <typename Body>
+    double measure(Body body) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(stop - start).count();
+    }
+
+    void report(const char* name, size_t records, double seconds) {
+        std::printf("%-32s %12.3f ms %10.2f Mrecords/s\n", name, seconds * 1e3, records / seconds / 1e6);
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+#ifdef S21_MAPPED_VECTOR_MMAP
+    size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+    std::string directory = argc > 2 ? argv[2] : "/tmp";
+    std::string stream_path = directory + "/bench_s21_records.txt";
+    std::string mapped_path = directory + "/bench_s21_records.vec";
+    std::remove(stream_path.c_str());
+    std::remove(mapped_path.c_str());
+    double sink = 0;
+
+    std::printf("%zu records of %zu bytes\n", n, sizeof(Record));
+    report("ofstream << per element", n, measure([&] {
+               std::ofstream out(stream_path);
+               for(size_t i = 0; i < n; ++i) out << i << ' ' << i * 0.5 << ' ' << i % 100 << '\n';
+           }));
+    report("mapped_vector::push_back", n, measure([&] {
+               s21::mapped_vector<Record> v(mapped_path);
+               for(size_t i = 0; i < n; ++i) v.push_back({i, i * 0.5, int32_t(i % 100)});
+           }));
+    report("ifstream >> into vector", n, measure([&] {
+               std::ifstream in(stream_path);
+               s21::vector<Record> v;
+               Record r;
+               while(in >> r.id >> r.price >> r.quantity) v.push_back(r);
+               sink += v.back().price;
+           }));
+    report("mapped_vector reopen read-only", n, measure([&] {
+               const s21::mapped_vector<Record> v(mapped_path, s21::map_mode::read_only);
+               sink += v.back().price;
+           }));
+    report("mapped_vector reopen + scan", n, measure([&] {
+               const s21::mapped_vector<Record> v(mapped_path, s21::map_mode::read_only);
+               for(const Record& r : v) sink += r.quantity;
+           }));
+
+    std::remove(stream_path.c_str());
+    std::remove(mapped_path.c_str());
+    if(sink == 42) std::printf("\n");
+#else
+    (void) argc;
+    (void) argv;
+    std::printf("mapped_vector needs mmap and mremap (Linux)\n");
+#endif
+    return 0;
+}
@@ -0,0 +1,454 @@
+#ifndef S21_CONTAINERS_MAPPED_VECTOR
+#define S21_CONTAINERS_MAPPED_VECTOR
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "./../common/s21_access.h"
+#include "./../vector/s21_vector_growth.h"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define S21_MAPPED_VECTOR_MMAP 1
+#endif
+
+namespace s21 {
+#ifdef S21_MAPPED_VECTOR_MMAP
+    enum class map_mode { read_write, read_only };
+
+    // A vector of trivially copyable records that lives in a file. The file is mapped MAP_SHARED, so
+    // the elements are the page cache: writes reach the file without any serialization step, and
+    // reopening the file maps the previous contents back in O(1) instead of parsing them. Growth
+    // extends the file with ftruncate and the mapping with mremap(MREMAP_MAYMOVE); like a vector
+    // reallocation, that invalidates pointers and iterators.
+    //
+    // The file starts with a 64-byte header holding a magic number, the element size and alignment
+    // and the current size; the elements follow it, and capacity is whatever else the file holds.
+    // Opening a file written for a different element size or alignment throws. The kernel writes
+    // dirty pages back on its own schedule, even after a crash of the process; call sync() when the
+    // data must be on disk before going on.
+    //
+    // map_mode::read_only opens an existing file with PROT_READ for zero-copy startup. Anything that
+    // would change the size throws std::logic_error, and writing through an element reference is a
+    // segmentation fault, so hold such a vector as const. A moved-from vector is closed: it is empty
+    // and behaves like a read-only one.
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    class mapped_vector {
+        static_assert(alignof(T) <= 64, "mapped_vector elements are aligned to the 64-byte header at most");
+
+    public:
+        using value_type = T;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using size_type = size_t;
+
+    private:
+        struct m_Header {
+            std::uint64_t magic;
+            std::uint32_t version;
+            std::uint32_t element_size;
+            std::uint32_t element_align;
+            std::uint32_t reserved;
+            std::uint64_t size;
+            unsigned char padding[32];
+        };
+        static_assert(sizeof(m_Header) == 64);
+
+        static constexpr std::uint64_t m_magic = 0x726f746365763132;  // "21vector"
+        static constexpr std::uint32_t m_version = 1;
+        static constexpr size_type m_header_size = sizeof(m_Header);
+
+        int m_fd;
+        unsigned char* m_map;
+        size_t m_length;
+        T* m_data;
+        size_type m_size;
+        size_type m_capacity;
+        bool m_writable;
+
+        m_Header* header() const noexcept { return reinterpret_cast<m_Header*>(m_map); }
+
+        [[noreturn]] static void fail(const char* what) { throw std::system_error(errno, std::generic_category(), what); }
+
+        static size_t page_size() noexcept {
+            static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            return size;
+        }
+
+        static size_type capacity_of(size_t length) noexcept {
+            return length > m_header_size ? (length - m_header_size) / sizeof(T) : 0;
+        }
+
+        // File length for at least count elements, rounded up to whole pages.
+        static size_t length_for(size_type count) noexcept {
+            size_t page = page_size();
+            return (m_header_size + count * sizeof(T) + page - 1) / page * page;
+        }
+
+        void require_writable() const {
+            if(!m_writable) throw std::logic_error("mapped_vector is read-only");
+        }
+
+        // Writes the size through to the file header; called after every change of m_size.
+        void publish() noexcept { header()->size = m_size; }
+
+        // Sets the file and the mapping to length bytes, moving the mapping when it cannot grow in place.
+        void remap(size_t length) {
+            if(length == m_length) return;
+            if(ftruncate(m_fd, static_cast<off_t>(length)) != 0) fail("mapped_vector: ftruncate");
+            void* moved = mremap(m_map, m_length, length, MREMAP_MAYMOVE);
+            if(moved == MAP_FAILED) {
+                std::error_code error(errno, std::generic_category());
+                // Best effort: give the file back the length that the unchanged mapping covers.
+                [[maybe_unused]] int restored = ftruncate(m_fd, static_cast<off_t>(m_length));
+                throw std::system_error(error, "mapped_vector: mremap");
+            }
+            m_map = static_cast<unsigned char*>(moved);
+            m_length = length;
+            m_data = reinterpret_cast<T*>(m_map + m_header_size);
+            m_capacity = capacity_of(length);
+        }
+
+        void map_file(size_t length) {
+            int protection = m_writable ? PROT_READ | PROT_WRITE : PROT_READ;
+            void* data = mmap(nullptr, length, protection, MAP_SHARED, m_fd, 0);
+            if(data == MAP_FAILED) fail("mapped_vector: mmap");
+            m_map = static_cast<unsigned char*>(data);
+            m_length = length;
+            m_data = reinterpret_cast<T*>(m_map + m_header_size);
+            m_capacity = capacity_of(length);
+        }
+
+        // Maps an existing file after checking that its header describes this element type.
+        void open_existing(size_t length) {
+            if(length < m_header_size) throw std::runtime_error("mapped_vector: file is too short for a header");
+            map_file(length);
+            const m_Header& head = *header();
+            if(head.magic != m_magic || head.version != m_version) {
+                throw std::runtime_error("mapped_vector: not a mapped_vector file");
+            }
+            if(head.element_size != sizeof(T) || head.element_align != alignof(T)) {
+                throw std::runtime_error("mapped_vector: file holds elements of another type");
+            }
+            if(head.size > m_capacity) throw std::runtime_error("mapped_vector: size exceeds the file length");
+            m_size = static_cast<size_type>(head.size);
+        }
+
+        void create_new() {
+            size_t length = length_for(0);
+            if(ftruncate(m_fd, static_cast<off_t>(length)) != 0) fail("mapped_vector: ftruncate");
+            map_file(length);
+            m_Header& head = *header();
+            std::memset(&head, 0, sizeof(head));
+            head.magic = m_magic;
+            head.version = m_version;
+            head.element_size = sizeof(T);
+            head.element_align = alignof(T);
+            m_size = 0;
+            publish();
+        }
+
+        void close() noexcept {
+            if(m_map != nullptr) munmap(m_map, m_length);
+            if(m_fd >= 0) ::close(m_fd);
+            m_fd = -1;
+            m_map = nullptr;
+            m_length = 0;
+            m_data = nullptr;
+            m_size = 0;
+            m_capacity = 0;
+            m_writable = false;
+        }
+
+        void steal(mapped_vector& other) noexcept {
+            m_fd = std::exchange(other.m_fd, -1);
+            m_map = std::exchange(other.m_map, nullptr);
+            m_length = std::exchange(other.m_length, 0);
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_capacity = std::exchange(other.m_capacity, 0);
+            m_writable = std::exchange(other.m_writable, false);
+        }
+
+        void grow_for(size_type extra) {
+            if(extra > max_size() - m_size) throw std::length_error("mapped_vector is too long");
+            if(m_size + extra > m_capacity) reserve(double_growth::next_capacity(m_capacity, m_size + extra, sizeof(T)));
+        }
+
+        void check_position(const_iterator pos) const {
+            if(pos < begin() || pos > end()) throw std::out_of_range("Insert position out of range");
+        }
+
+        // Shifts the tail right by count and returns the index of the gap. Elements are bytes, so
+        // the caller fills the gap by plain assignment.
+        size_type open_gap(const_iterator pos, size_type count) {
+            require_writable();
+            check_position(pos);
+            size_type index = static_cast<size_type>(pos - begin());
+            grow_for(count);
+            std::memmove(static_cast<void*>(m_data + index + count), static_cast<const void*>(m_data + index),
+                         (m_size - index) * sizeof(T));
+            m_size += count;
+            return index;
+        }
+
+    public:
+        // Opens path, creating an empty vector file when it does not exist and mode is read_write.
+        explicit mapped_vector(const std::string& path, map_mode mode = map_mode::read_write) :
+            m_fd(-1), m_map(nullptr), m_length(0), m_data(nullptr), m_size(0), m_capacity(0),
+            m_writable(mode == map_mode::read_write) {
+            int flags = m_writable ? O_RDWR | O_CREAT | O_CLOEXEC : O_RDONLY | O_CLOEXEC;
+            m_fd = ::open(path.c_str(), flags, 0644);
+            if(m_fd < 0) fail("mapped_vector: open");
+            try {
+                struct stat info;
+                if(fstat(m_fd, &info) != 0) fail("mapped_vector: fstat");
+                size_t length = static_cast<size_t>(info.st_size);
+                if(length == 0 && m_writable) {
+                    create_new();
+                } else {
+                    open_existing(length);
+                }
+            }
+            catch(...) {
+                close();
+                throw;
+            }
+        }
+
+        mapped_vector(const mapped_vector&) = delete;
+        mapped_vector& operator=(const mapped_vector&) = delete;
+
+        mapped_vector(mapped_vector&& other) noexcept :
+            m_fd(-1), m_map(nullptr), m_length(0), m_data(nullptr), m_size(0), m_capacity(0), m_writable(false) {
+            steal(other);
+        }
+
+        mapped_vector& operator=(mapped_vector&& other) noexcept {
+            if(this != &other) {
+                close();
+                steal(other);
+            }
+            return *this;
+        }
+
+        // Unmaps the file without an msync; the kernel still writes the dirty pages back.
+        ~mapped_vector() { close(); }
+
+        // cppcheck-suppress passedByValue
+        reference at(size_type pos) {
+            if(pos >= m_size) throw std::out_of_range("Index out of range");
+            return m_data[pos];
+        }
+
+        // cppcheck-suppress passedByValue
+        const_reference at(size_type pos) const {
+            if(pos >= m_size) throw std::out_of_range("Index out of range");
+            return m_data[pos];
+        }
+
+        // cppcheck-suppress passedByValue
+        reference operator[](size_type pos) {
+            check_access(pos < m_size, "Index out of range");
+            return m_data[pos];
+        }
+
+        // cppcheck-suppress passedByValue
+        const_reference operator[](size_type pos) const {
+            check_access(pos < m_size, "Index out of range");
+            return m_data[pos];
+        }
+
+        reference front() {
+            check_access(m_size > 0, "mapped_vector is empty");
+            return m_data[0];
+        }
+
+        const_reference front() const {
+            check_access(m_size > 0, "mapped_vector is empty");
+            return m_data[0];
+        }
+
+        reference back() {
+            check_access(m_size > 0, "mapped_vector is empty");
+            return m_data[m_size - 1];
+        }
+
+        const_reference back() const {
+            check_access(m_size > 0, "mapped_vector is empty");
+            return m_data[m_size - 1];
+        }
+
+        T* data() noexcept { return m_data; }
+        const T* data() const noexcept { return m_data; }
+
+        iterator begin() noexcept { return m_data; }
+        iterator end() noexcept { return m_data + m_size; }
+        const_iterator begin() const noexcept { return m_data; }
+        const_iterator end() const noexcept { return m_data + m_size; }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator cend() const noexcept { return end(); }
+
+        bool empty() const noexcept { return m_size == 0; }
+
+        size_type size() const noexcept { return m_size; }
+
+        size_type capacity() const noexcept { return m_capacity; }
+
+        // cppcheck-suppress functionStatic
+        size_type max_size() const noexcept {
+            return (static_cast<size_type>(std::numeric_limits<off_t>::max()) - m_header_size) / sizeof(T);
+        }
+
+        bool is_open() const noexcept { return m_map != nullptr; }
+
+        bool read_only() const noexcept { return !m_writable; }
+
+        // Extends the file to hold at least count elements, in whole pages.
+        // cppcheck-suppress passedByValue
+        void reserve(size_type count) {
+            require_writable();
+            if(count > max_size()) throw std::length_error("mapped_vector is too long");
+            if(count > m_capacity) remap(length_for(count));
+        }
+
+        // Truncates the file right after the last element's page.
+        void shrink_to_fit() {
+            require_writable();
+            remap(length_for(m_size));
+        }
+
+        // Flushes the header and the elements to disk and waits for the write to finish.
+        void sync() const {
+            if(m_map != nullptr && msync(m_map, m_length, MS_SYNC) != 0) fail("mapped_vector: msync");
+        }
+
+        // Forgets the elements; the file keeps its length until shrink_to_fit().
+        void clear() {
+            require_writable();
+            m_size = 0;
+            publish();
+        }
+
+        // cppcheck-suppress passedByValue
+        void push_back(const_reference value) { emplace_back(value); }
+
+        template <typename... Args>
+        reference emplace_back(Args&&... args) {
+            require_writable();
+            T item(std::forward<Args>(args)...);
+            grow_for(1);
+            ::new(static_cast<void*>(m_data + m_size)) T(item);
+            ++m_size;
+            publish();
+            return back();
+        }
+
+        void pop_back() {
+            require_writable();
+            if(empty()) throw std::out_of_range("There are nothing to pop");
+            --m_size;
+            publish();
+        }
+
+        // cppcheck-suppress passedByValue
+        iterator insert(const_iterator pos, const_reference value) { return insert(pos, 1, value); }
+
+        // cppcheck-suppress passedByValue
+        iterator insert(const_iterator pos, size_type count, const_reference value) {
+            T item(value);
+            size_type index = open_gap(pos, count);
+            std::fill_n(m_data + index, count, item);
+            publish();
+            return begin() + index;
+        }
+
+        // The source must not refer to elements of this vector, which growth may move.
+        template <std::forward_iterator ForwardIt>
+        iterator insert(const_iterator pos, ForwardIt first, ForwardIt last) {
+            size_type index = open_gap(pos, static_cast<size_type>(std::distance(first, last)));
+            std::copy(first, last, m_data + index);
+            publish();
+            return begin() + index;
+        }
+
+        template <std::ranges::forward_range Range>
+        void append_range(Range&& range) {
+            insert(end(), std::ranges::begin(range), std::ranges::end(range));
+        }
+
+        void erase(iterator pos) {
+            require_writable();
+            if(pos < begin() || pos >= end()) throw std::out_of_range("Erase position out of range");
+            erase(pos, pos + 1);
+        }
+
+        // Removes [first, last) and returns the iterator to the element that followed it.
+        iterator erase(const_iterator first, const_iterator last) {
+            require_writable();
+            if(first < begin() || first > last || last > end()) throw std::out_of_range("Erase range out of range");
+            size_type index = static_cast<size_type>(first - begin());
+            size_type count = static_cast<size_type>(last - first);
+            std::memmove(static_cast<void*>(m_data + index), static_cast<const void*>(m_data + index + count),
+                         (m_size - index - count) * sizeof(T));
+            m_size -= count;
+            publish();
+            return begin() + index;
+        }
+
+        template <std::forward_iterator ForwardIt>
+        void assign(ForwardIt first, ForwardIt last) {
+            clear();
+            insert(end(), first, last);
+        }
+
+        // cppcheck-suppress passedByValue
+        void assign(size_type count, const_reference value) {
+            T item(value);
+            clear();
+            insert(end(), count, item);
+        }
+
+        mapped_vector& operator=(std::initializer_list<value_type> const& items) {
+            assign(items.begin(), items.end());
+            return *this;
+        }
+
+        void swap(mapped_vector& other) noexcept {
+            std::swap(m_fd, other.m_fd);
+            std::swap(m_map, other.m_map);
+            std::swap(m_length, other.m_length);
+            std::swap(m_data, other.m_data);
+            std::swap(m_size, other.m_size);
+            std::swap(m_capacity, other.m_capacity);
+            std::swap(m_writable, other.m_writable);
+        }
+
+        template <std::ranges::input_range Range>
+        bool operator==(const Range& other) const {
+            return std::equal(begin(), end(), std::ranges::begin(other), std::ranges::end(other));
+        }
+    };
+#endif
+} // namespace s21
+
+#endif
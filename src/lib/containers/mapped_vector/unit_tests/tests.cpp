@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <unistd.h>
+
+#include "./../../vector/s21_vector.h"
+#include "./../s21_mapped_vector.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+#ifdef S21_MAPPED_VECTOR_MMAP
+namespace {
+    struct Record {
+        uint64_t id;
+        double price;
+        int32_t quantity;
+
+        bool operator==(const Record&) const = default;
+    };
+
+    // A path in the test temp directory that is removed again at the end of the test.
+    struct TempFile {
+        std::string path;
+
+        explicit TempFile(const std::string& name) :
+            path(::testing::TempDir() + "s21_mapped_vector_" + std::to_string(getpid()) + "_" + name) {
+            std::remove(path.c_str());
+        }
+        ~TempFile() { std::remove(path.c_str()); }
+    };
+
+    long file_size(const std::string& path) {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        return static_cast<long>(in.tellg());
+    }
+} // namespace
+
+TEST(mappedVectorTest, CreatesFileAndPushesBack) {
+    TempFile file("create");
+    mapped_vector<int> v(file.path);
+    EXPECT_TRUE(v.is_open());
+    EXPECT_FALSE(v.read_only());
+    EXPECT_TRUE(v.empty());
+    for(int i = 0; i < 100000; ++i) v.push_back(i * 2);
+    EXPECT_EQ(v.size(), 100000u);
+    EXPECT_EQ(v.front(), 0);
+    EXPECT_EQ(v.back(), 199998);
+    EXPECT_EQ(v.at(500), 1000);
+    EXPECT_THROW(v.at(100000), std::out_of_range);
+    EXPECT_GE(v.capacity(), v.size());
+    EXPECT_EQ(file_size(file.path) % sysconf(_SC_PAGESIZE), 0);
+    EXPECT_GE(file_size(file.path), long(64 + 100000 * sizeof(int)));
+}
+
+TEST(mappedVectorTest, ReopenKeepsRecords) {
+    TempFile file("reopen");
+    {
+        mapped_vector<Record> v(file.path);
+        for(uint64_t i = 0; i < 5000; ++i) v.push_back({i, i * 0.25, int32_t(i % 7)});
+        v.sync();
+    }
+    {
+        mapped_vector<Record> v(file.path);
+        ASSERT_EQ(v.size(), 5000u);
+        EXPECT_EQ(v[4321], (Record{4321, 4321 * 0.25, 4321 % 7}));
+        v.pop_back();
+        v[0].quantity = 99;
+    }
+    const mapped_vector<Record> v(file.path, map_mode::read_only);
+    EXPECT_TRUE(v.read_only());
+    EXPECT_EQ(v.size(), 4999u);
+    EXPECT_EQ(v.front().quantity, 99);
+    EXPECT_EQ(v.back().id, 4998u);
+}
+
+TEST(mappedVectorTest, ReadOnlyRejectsChanges) {
+    TempFile file("readonly");
+    {
+        mapped_vector<int> v(file.path);
+        v = {1, 2, 3};
+    }
+    mapped_vector<int> v(file.path, map_mode::read_only);
+    EXPECT_EQ(v, s21::vector<int>({1, 2, 3}));
+    EXPECT_THROW(v.push_back(4), std::logic_error);
+    EXPECT_THROW(v.pop_back(), std::logic_error);
+    EXPECT_THROW(v.reserve(1000), std::logic_error);
+    EXPECT_THROW(v.clear(), std::logic_error);
+    EXPECT_THROW(v.erase(v.begin()), std::logic_error);
+    EXPECT_NO_THROW(v.sync());
+    EXPECT_EQ(v.size(), 3u);
+}
+
+TEST(mappedVectorTest, OpenErrors) {
+    TempFile missing("missing");
+    EXPECT_THROW(mapped_vector<int>(missing.path, map_mode::read_only), std::system_error);
+
+    TempFile other("other_type");
+    {
+        mapped_vector<int> v(other.path);
+        v.push_back(1);
+    }
+    EXPECT_THROW(mapped_vector<double>(other.path), std::runtime_error);
+    EXPECT_NO_THROW(mapped_vector<unsigned>(other.path));
+
+    TempFile garbage("garbage");
+    std::ofstream(garbage.path) << "this is not a vector file, just some text that is long enough for a header";
+    EXPECT_THROW(mapped_vector<int>(garbage.path), std::runtime_error);
+}
+
+TEST(mappedVectorTest, InsertEraseAssign) {
+    TempFile file("edit");
+    mapped_vector<int> v(file.path);
+    s21::vector<int> source(10);
+    std::iota(source.begin(), source.end(), 0);
+    v.append_range(source);
+    auto it = v.insert(v.begin() + 3, 2, -1);
+    EXPECT_EQ(it - v.begin(), 3);
+    v.insert(v.begin(), 100);
+    v.insert(v.end(), source.begin(), source.begin() + 2);
+    EXPECT_EQ(v, s21::vector<int>({100, 0, 1, 2, -1, -1, 3, 4, 5, 6, 7, 8, 9, 0, 1}));
+    auto next = v.erase(v.begin() + 4, v.begin() + 6);
+    EXPECT_EQ(*next, 3);
+    v.erase(v.begin());
+    EXPECT_EQ(v, s21::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1}));
+    EXPECT_THROW(v.insert(v.end() + 1, 5), std::out_of_range);
+    EXPECT_THROW(v.erase(v.end()), std::out_of_range);
+    v.assign(3, 7);
+    EXPECT_EQ(v, s21::vector<int>({7, 7, 7}));
+    v.emplace_back(v.front());
+    EXPECT_EQ(v.size(), 4u);
+}
+
+TEST(mappedVectorTest, ReserveAndShrinkResizeTheFile) {
+    TempFile file("shrink");
+    mapped_vector<uint64_t> v(file.path);
+    v.reserve(1 << 20);
+    EXPECT_GE(v.capacity(), size_t(1) << 20);
+    EXPECT_GE(file_size(file.path), long(8 << 20));
+    for(uint64_t i = 0; i < 10; ++i) v.push_back(i);
+    v.shrink_to_fit();
+    EXPECT_EQ(file_size(file.path), long(sysconf(_SC_PAGESIZE)));
+    EXPECT_EQ(v.at(9), 9u);
+    v.clear();
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(file_size(file.path), long(sysconf(_SC_PAGESIZE)));
+}
+
+TEST(mappedVectorTest, MoveAndSwap) {
+    TempFile a_file("a");
+    TempFile b_file("b");
+    mapped_vector<int> a(a_file.path);
+    a = {1, 2};
+    mapped_vector<int> b(b_file.path);
+    b = {3};
+    a.swap(b);
+    EXPECT_EQ(a, s21::vector<int>({3}));
+    mapped_vector<int> c(std::move(b));
+    EXPECT_FALSE(b.is_open());
+    EXPECT_TRUE(b.empty());
+    EXPECT_THROW(b.push_back(1), std::logic_error);
+    EXPECT_EQ(c.size(), 2u);
+    c.push_back(5);
+    b = std::move(c);
+    EXPECT_EQ(b, s21::vector<int>({1, 2, 5}));
+    EXPECT_EQ(mapped_vector<int>(a_file.path).size(), 3u);
+}
+#endif
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
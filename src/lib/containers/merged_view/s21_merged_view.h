@@ -0,0 +1,178 @@
+#ifndef S21_CONTAINERS_MERGED_VIEW
+#define S21_CONTAINERS_MERGED_VIEW
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+    // Lazy ordered union of N ordered containers (map/set/multiset shards).
+    // Elements are yielded in key order through a binary heap of source cursors that lives
+    // inside the iterator, so neither the view nor a scan over it allocates. Equivalent keys
+    // coming from different sources are yielded in source order, or only once when Unique is set.
+    // Keys are ordered by the shards' own comparator unless another Compare is given.
+    template <typename Container, size_t N, bool Unique = false, typename Compare = typename Container::key_compare>
+    class merged_view {
+        static_assert(N > 0, "merged_view needs at least one source");
+
+    public:
+        using container_type = Container;
+        using key_type = typename Container::key_type;
+        using value_type = typename Container::value_type;
+        using source_iterator = typename Container::iterator;
+        using reference = decltype(*std::declval<source_iterator&>());
+        using size_type = size_t;
+
+    private:
+        struct m_Cursor {
+            source_iterator current;
+            source_iterator last;
+        };
+
+        const Container* m_sources[N];
+
+        static const key_type& key_of(const value_type& value) noexcept {
+            if constexpr(std::is_same_v<key_type, value_type>) {
+                return value;
+            } else {
+                return value.first;
+            }
+        }
+
+    public:
+        class MergedIterator {
+            friend class merged_view;
+
+        private:
+            m_Cursor m_cursors[N];
+            size_type m_heap[N];
+            size_type m_heap_size;
+
+            bool before(size_type a, size_type b) const {
+                const key_type& key_a = key_of(*m_cursors[a].current);
+                const key_type& key_b = key_of(*m_cursors[b].current);
+                if(Compare()(key_a, key_b)) return true;
+                if(Compare()(key_b, key_a)) return false;
+                return a < b;
+            }
+
+            void sift_down(size_type pos) {
+                while(true) {
+                    size_type smallest = pos;
+                    size_type left = 2 * pos + 1;
+                    size_type right = left + 1;
+                    if(left < m_heap_size && before(m_heap[left], m_heap[smallest])) smallest = left;
+                    if(right < m_heap_size && before(m_heap[right], m_heap[smallest])) smallest = right;
+                    if(smallest == pos) return;
+                    std::swap(m_heap[pos], m_heap[smallest]);
+                    pos = smallest;
+                }
+            }
+
+            void build_heap() {
+                m_heap_size = 0;
+                for(size_type i = 0; i < N; ++i) {
+                    if(m_cursors[i].current != m_cursors[i].last) m_heap[m_heap_size++] = i;
+                }
+                for(size_type i = m_heap_size / 2; i-- > 0;) sift_down(i);
+            }
+
+            // Moves the cursor on top of the heap one step forward and restores the heap order.
+            void advance_top() {
+                m_Cursor& top = m_cursors[m_heap[0]];
+                ++top.current;
+                if(top.current == top.last) { m_heap[0] = m_heap[--m_heap_size]; }
+                if(m_heap_size > 0) sift_down(0);
+            }
+
+        public:
+            MergedIterator() : m_cursors(), m_heap(), m_heap_size(0) {}
+
+            reference operator*() const { return *m_cursors[m_heap[0]].current; }
+
+            const value_type* operator->() const { return &(operator*()); }
+
+            MergedIterator& operator++() {
+                if constexpr(Unique) {
+                    const key_type& previous = key_of(operator*());
+                    advance_top();
+                    while(m_heap_size > 0 && !Compare()(previous, key_of(operator*()))) advance_top();
+                } else {
+                    advance_top();
+                }
+                return *this;
+            }
+
+            MergedIterator operator++(int) {
+                MergedIterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            // Index of the source the current element comes from.
+            size_type source() const noexcept { return m_heap[0]; }
+
+            bool operator==(const MergedIterator& other) const {
+                if(m_heap_size != other.m_heap_size) return false;
+                if(m_heap_size == 0) return true;
+                for(size_type i = 0; i < N; ++i) {
+                    if(m_cursors[i].current != other.m_cursors[i].current) return false;
+                }
+                return true;
+            }
+
+            bool operator!=(const MergedIterator& other) const { return !(*this == other); }
+        };
+
+        using iterator = MergedIterator;
+        using const_iterator = MergedIterator;
+
+        template <typename... Sources>
+        explicit merged_view(const Sources&... sources) : m_sources{&sources...} {
+            static_assert(sizeof...(Sources) == N, "merged_view expects exactly N sources");
+            static_assert((std::is_same_v<Sources, Container> && ...), "all sources must share one container type");
+        }
+
+        iterator begin() const {
+            iterator it;
+            for(size_type i = 0; i < N; ++i) it.m_cursors[i] = {m_sources[i]->begin(), m_sources[i]->end()};
+            it.build_heap();
+            return it;
+        }
+
+        // Starts a range scan at the first element not less than key in every source.
+        iterator lower_bound(const key_type& key) const {
+            iterator it;
+            for(size_type i = 0; i < N; ++i) it.m_cursors[i] = {m_sources[i]->lower_bound(key), m_sources[i]->end()};
+            it.build_heap();
+            return it;
+        }
+
+        iterator end() const { return iterator(); }
+
+        bool empty() const {
+            for(size_type i = 0; i < N; ++i) {
+                if(!m_sources[i]->empty()) return false;
+            }
+            return true;
+        }
+
+        static constexpr size_type sources() noexcept { return N; }
+    };
+
+    template <typename Container, typename... Rest>
+    merged_view(const Container&, const Rest&...) -> merged_view<Container, 1 + sizeof...(Rest)>;
+
+    template <typename Container, typename... Rest>
+    merged_view<Container, 1 + sizeof...(Rest)> make_merged_view(const Container& first, const Rest&... rest) {
+        return merged_view<Container, 1 + sizeof...(Rest)>(first, rest...);
+    }
+
+    template <typename Container, typename... Rest>
+    merged_view<Container, 1 + sizeof...(Rest), true> make_unique_merged_view(const Container& first, const Rest&... rest) {
+        return merged_view<Container, 1 + sizeof...(Rest), true>(first, rest...);
+    }
+} // namespace s21
+
+#endif
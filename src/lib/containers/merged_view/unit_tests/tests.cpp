@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <vector>
+
+#include "./../../map/s21_map.h"
+#include "./../../multiset/s21_multiset.h"
+#include "./../../set/s21_set.h"
+#include "./../../testing_include/test_include.h"
+#include "./../s21_merged_view.h"
+
+using namespace s21;
+
+TEST(MergedViewTest, EmptySources) {
+    set<int> a;
+    set<int> b;
+    merged_view view(a, b);
+    EXPECT_TRUE(view.empty());
+    EXPECT_TRUE(view.begin() == view.end());
+}
+
+TEST(MergedViewTest, SingleSource) {
+    set<int> a{3, 1, 2};
+    std::vector<int> result;
+    for(int value : make_merged_view(a)) { result.push_back(value); }
+    EXPECT_EQ(result, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(MergedViewTest, MergesSetsInOrder) {
+    set<int> a{1, 4, 7, 10};
+    set<int> b{2, 5, 8};
+    set<int> c{3, 6, 9, 11, 12};
+    merged_view view(a, b, c);
+    EXPECT_EQ(view.sources(), (size_t) 3);
+
+    std::vector<int> result;
+    for(auto it = view.begin(); it != view.end(); ++it) { result.push_back(*it); }
+    EXPECT_EQ(result, (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}));
+    EXPECT_EQ(a.size(), (size_t) 4);
+    EXPECT_EQ(b.size(), (size_t) 3);
+    EXPECT_EQ(c.size(), (size_t) 5);
+}
+
+TEST(MergedViewTest, KeepsDuplicatesInSourceOrder) {
+    map<int, char> a{{1, 'a'}, {3, 'a'}};
+    map<int, char> b{{1, 'b'}, {2, 'b'}, {3, 'b'}};
+    std::vector<std::pair<int, char>> result;
+    for(const auto& item : make_merged_view(a, b)) { result.emplace_back(item.first, item.second); }
+    std::vector<std::pair<int, char>> expected{{1, 'a'}, {1, 'b'}, {2, 'b'}, {3, 'a'}, {3, 'b'}};
+    EXPECT_EQ(result, expected);
+}
+
+TEST(MergedViewTest, CollapsesDuplicates) {
+    set<int> a{1, 2, 3, 5};
+    set<int> b{2, 3, 4};
+    set<int> c{3, 5, 6};
+    std::vector<int> result;
+    for(int value : make_unique_merged_view(a, b, c)) { result.push_back(value); }
+    EXPECT_EQ(result, (std::vector<int>{1, 2, 3, 4, 5, 6}));
+}
+
+TEST(MergedViewTest, CollapsesDuplicatesInsideMultiset) {
+    multiset<int> a{1, 1, 2, 2, 2};
+    multiset<int> b{2, 3, 3};
+    std::vector<int> result;
+    for(int value : make_unique_merged_view(a, b)) { result.push_back(value); }
+    EXPECT_EQ(result, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(MergedViewTest, ReportsSource) {
+    map<int, int> a{{2, 0}};
+    map<int, int> b{{1, 0}, {3, 0}};
+    auto view = make_merged_view(a, b);
+    auto it = view.begin();
+    EXPECT_EQ(it->first, 1);
+    EXPECT_EQ(it.source(), (size_t) 1);
+    ++it;
+    EXPECT_EQ(it->first, 2);
+    EXPECT_EQ(it.source(), (size_t) 0);
+    it++;
+    EXPECT_EQ(it->first, 3);
+    EXPECT_EQ(it.source(), (size_t) 1);
+    ++it;
+    EXPECT_TRUE(it == view.end());
+}
+
+TEST(MergedViewTest, IteratorsAreIndependent) {
+    set<int> a{1, 3};
+    set<int> b{2, 4};
+    merged_view view(a, b);
+    auto first = view.begin();
+    auto second = first;
+    ++second;
+    EXPECT_EQ(*first, 1);
+    EXPECT_EQ(*second, 2);
+    EXPECT_TRUE(first != second);
+    ++first;
+    EXPECT_TRUE(first == second);
+}
+
+TEST(MergedViewTest, OneSourceEmpty) {
+    set<int> a;
+    set<int> b{5, 6};
+    std::vector<int> result;
+    for(int value : make_merged_view(a, b)) { result.push_back(value); }
+    EXPECT_EQ(result, (std::vector<int>{5, 6}));
+}
+
+TEST(MergedViewTest, ManyShards) {
+    set<int> shards[4];
+    for(int i = 0; i < 400; ++i) { shards[i % 4].insert(i); }
+    int expected = 0;
+    for(int value : make_merged_view(shards[0], shards[1], shards[2], shards[3])) { EXPECT_EQ(value, expected++); }
+    EXPECT_EQ(expected, 400);
+}
+
+TEST(MergedViewTest, FollowsShardComparator) {
+    set<int, std::greater<int>> a{9, 5, 1};
+    set<int, std::greater<int>> b{8, 6, 2};
+    std::vector<int> result;
+    for(int value : make_merged_view(a, b)) { result.push_back(value); }
+    EXPECT_EQ(result, (std::vector<int>{9, 8, 6, 5, 2, 1}));
+}
+
+TEST(MergedViewTest, RangeScanFromLowerBound) {
+    set<int> a{1, 4, 7, 10};
+    set<int> b{2, 5, 8};
+    merged_view view(a, b);
+    std::vector<int> result;
+    for(auto it = view.lower_bound(4); it != view.end() && *it < 9; ++it) { result.push_back(*it); }
+    EXPECT_EQ(result, (std::vector<int>{4, 5, 7, 8}));
+    EXPECT_TRUE(view.lower_bound(11) == view.end());
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
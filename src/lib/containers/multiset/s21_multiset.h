@@ -2,27 +2,33 @@
 #define S21_CONTAINERS_MULTISET
 
 #include <functional>
+#include <memory_resource>
 
 #include "./../tree/s21_tree.h"
 #include "./../vector/s21_vector.h"
 
 namespace s21 {
-    template <typename TKey, typename Compare = std::less<TKey>>
+    template <typename TKey, typename Compare = std::less<TKey>, typename Balance = red_black_balance,
+              bool Threaded = false, typename Allocator = std::allocator<TKey>>
     class multiset {
     private:
-        BinaryTree<TKey, TKey, Compare, const TKey> m_tree;
+        BinaryTree<TKey, TKey, Compare, const TKey, Balance, Threaded, Allocator> m_tree;
 
     public:
         using key_type = TKey;
         using value_type = TKey;
+        using key_compare = Compare;
         using reference = value_type&;
         using const_reference = const value_type&;
-        using iterator = typename BinaryTree<TKey, TKey, Compare, const TKey>::iterator;
-        using const_iterator = typename BinaryTree<TKey, TKey, Compare, const TKey>::const_iterator;
+        using iterator = typename BinaryTree<TKey, TKey, Compare, const TKey, Balance, Threaded, Allocator>::iterator;
+        using const_iterator = typename BinaryTree<TKey, TKey, Compare, const TKey, Balance, Threaded, Allocator>::const_iterator;
         using size_type = size_t;
+        using allocator_type = Allocator;
 
         multiset() = default;
 
+        explicit multiset(const Allocator& alloc) : m_tree(alloc) {}
+
         explicit multiset(std::initializer_list<TKey> const& list) {
             for(const auto& value : list) insert(value);
         }
@@ -44,6 +50,7 @@ namespace s21 {
         size_type size() const { return m_tree.size(); }
         size_type max_size() const { return m_tree.max_size(); }
         void clear() { m_tree.clear(); }
+        allocator_type get_allocator() const noexcept { return m_tree.get_allocator(); }
 
         iterator insert(const value_type& value) { return m_tree.insert(value, value); }
 
@@ -61,6 +68,14 @@ namespace s21 {
         iterator lower_bound(const key_type& key) const { return m_tree.lower_bound(key); }
         iterator upper_bound(const key_type& key) const { return m_tree.upper_bound(key); }
 
+        // Finger search: start from an iterator close to the key instead of the root.
+        // cppcheck-suppress passedByValue
+        iterator find(iterator from, const key_type& key) const { return m_tree.find(from, key); }
+        // cppcheck-suppress passedByValue
+        iterator lower_bound(iterator from, const key_type& key) const { return m_tree.lower_bound(from, key); }
+        // cppcheck-suppress passedByValue
+        iterator upper_bound(iterator from, const key_type& key) const { return m_tree.upper_bound(from, key); }
+
         template <typename... Args>
         s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
             s21::vector<std::pair<iterator, bool>> result;
@@ -68,5 +83,12 @@ namespace s21 {
             return result;
         }
     };
+
+    // Multisets whose nodes and keys come from a std::pmr::memory_resource.
+    namespace pmr {
+        template <typename TKey, typename Compare = std::less<TKey>, typename Balance = red_black_balance,
+                  bool Threaded = false>
+        using multiset = s21::multiset<TKey, Compare, Balance, Threaded, std::pmr::polymorphic_allocator<TKey>>;
+    } // namespace pmr
 } // namespace s21
 #endif
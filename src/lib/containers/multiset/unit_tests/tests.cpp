@@ -285,6 +285,16 @@ TEST(MultisetTest, InsertMany) {
     for(auto it = s.begin(); it != s.end(); ++it) { EXPECT_EQ(*it, ans[ans_id++]); }
 }
 
+TEST(MultisetTest, FingerSearch) {
+    multiset<int> ms{1, 3, 3, 3, 7, 7, 9};
+    auto it = ms.find(7);
+    auto first_three = ms.lower_bound(it, 3);
+    EXPECT_TRUE(first_three == ms.lower_bound(3));
+    EXPECT_TRUE(ms.upper_bound(first_three, 3) == ms.lower_bound(7));
+    EXPECT_EQ(*ms.find(first_three, 9), 9);
+    EXPECT_TRUE(ms.find(first_three, 8) == ms.end());
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     UTIL(RUN_ALL_TESTS());
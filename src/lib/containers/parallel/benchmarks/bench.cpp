@@ -0,0 +1,99 @@
+// Strong scaling of the parallel algorithms: the same input is processed by pools of 1, 2, 4, ...
+// threads up to the hardware concurrency, and every line reports throughput plus the speedup
+// over the single-threaded pool. std::sort and std::reduce give the sequential baseline.
+// Memory-bound kernels (transform, reduce, scan) stop scaling once the threads saturate memory
+// bandwidth; sort keeps scaling further because it does more work per byte.
+//
+// Usage: bench_s21_parallel [element_count] [grain]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <thread>
+
+#include "./../../vector/s21_vector.h"
+#include "./../s21_parallel.h"
+
+namespace {
+    template <typename Body>
+    double measure(Body body) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(stop - start).count();
+    }
+
+    void report(const char* algorithm, size_t threads, size_t ops, double seconds, double baseline) {
+        std::printf("%-16s %3zu threads %10.2f Mops/s %6.2fx\n", algorithm, threads, ops / seconds / 1e6,
+                    baseline / seconds);
+    }
+
+    s21::vector<uint64_t> random_keys(size_t n) {
+        s21::vector<uint64_t> keys(n);
+        std::mt19937_64 random(42);
+        for(uint64_t& key : keys) key = random();
+        return keys;
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20000000;
+    size_t grain = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 0;
+    size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+
+    const s21::vector<uint64_t> keys = random_keys(n);
+    s21::vector<uint64_t> work(n);
+    s21::vector<uint64_t> out(n);
+    uint64_t sink = 0;
+
+    std::printf("uint64_t, %zu elements, grain %s, up to %zu threads\n", n, grain ? argv[2] : "auto", hardware);
+    std::copy(keys.begin(), keys.end(), work.begin());
+    std::printf("%-16s %10.2f Mops/s\n", "std::sort", n / measure([&] { std::sort(work.begin(), work.end()); }) / 1e6);
+    std::printf("%-16s %10.2f Mops/s\n", "std::reduce",
+                n / measure([&] { sink += std::reduce(keys.begin(), keys.end(), uint64_t(0)); }) / 1e6);
+
+    double sort_base = 0;
+    double transform_base = 0;
+    double reduce_base = 0;
+    double scan_base = 0;
+    double partition_base = 0;
+    for(size_t threads = 1;; threads = std::min(threads * 2, hardware)) {
+        s21::parallel::thread_pool pool(threads);
+        s21::parallel::policy exec{&pool, grain};
+
+        std::copy(keys.begin(), keys.end(), work.begin());
+        double seconds = measure([&] { s21::parallel::sort(exec, work.begin(), work.end()); });
+        if(threads == 1) sort_base = seconds;
+        report("sort", threads, n, seconds, sort_base);
+
+        seconds = measure([&] {
+            s21::parallel::transform(exec, keys.begin(), keys.end(), out.begin(), [](uint64_t k) { return k * 3 + 1; });
+        });
+        if(threads == 1) transform_base = seconds;
+        report("transform", threads, n, seconds, transform_base);
+
+        seconds = measure([&] { sink += s21::parallel::reduce(exec, keys.begin(), keys.end(), uint64_t(0)); });
+        if(threads == 1) reduce_base = seconds;
+        report("reduce", threads, n, seconds, reduce_base);
+
+        seconds = measure([&] { s21::parallel::inclusive_scan(exec, keys.begin(), keys.end(), out.begin()); });
+        if(threads == 1) scan_base = seconds;
+        report("inclusive_scan", threads, n, seconds, scan_base);
+
+        std::copy(keys.begin(), keys.end(), work.begin());
+        seconds = measure([&] {
+            auto middle = s21::parallel::partition(exec, work.begin(), work.end(), [](uint64_t k) { return k & 1; });
+            sink += middle - work.begin();
+        });
+        if(threads == 1) partition_base = seconds;
+        report("partition", threads, n, seconds, partition_base);
+
+        if(threads == hardware) break;
+    }
+    if(sink == 42 && out[0] == 42) std::printf("\n");
+    return 0;
+}
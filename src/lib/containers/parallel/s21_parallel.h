@@ -0,0 +1,302 @@
+#ifndef S21_CONTAINERS_PARALLEL
+#define S21_CONTAINERS_PARALLEL
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "./s21_thread_pool.h"
+
+// Parallel versions of the common algorithms for contiguous data such as s21::vector and s21::array.
+// Each one takes an optional policy naming the thread pool to run on and the grain: the largest
+// number of elements a single task handles. Work is split in halves down to the grain, so small
+// inputs run inline on the calling thread without touching the pool.
+namespace s21::parallel {
+    struct policy {
+        thread_pool* pool = &thread_pool::global();
+        // Elements per task; 0 picks about eight tasks per thread, but never fewer than a few
+        // thousand elements per task so that scheduling stays cheap next to the work.
+        size_t grain = 0;
+
+        size_t grain_for(size_t count) const noexcept {
+            if(grain != 0) return grain;
+            return std::max<size_t>(4096, count / (pool->size() * 8) + 1);
+        }
+    };
+
+    namespace detail {
+        // sort and partition park elements in a scratch buffer; moves that cannot fail keep them
+        // from being lost halfway through.
+        template <typename T>
+        constexpr bool nothrow_movable =
+            std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>;
+
+        // Splits count elements in chunks of at most grain for the two-pass algorithms.
+        struct chunking {
+            size_t count;
+            size_t grain;
+
+            size_t chunks() const noexcept { return (count + grain - 1) / grain; }
+            size_t begin(size_t chunk) const noexcept { return chunk * grain; }
+            size_t end(size_t chunk) const noexcept { return std::min(count, begin(chunk) + grain); }
+        };
+
+        template <typename T>
+        class scratch_buffer {
+        public:
+            explicit scratch_buffer(size_t count) : m_data(std::allocator<T>().allocate(count)), m_count(count) {}
+            scratch_buffer(const scratch_buffer&) = delete;
+            scratch_buffer& operator=(const scratch_buffer&) = delete;
+            ~scratch_buffer() { std::allocator<T>().deallocate(m_data, m_count); }
+            T* data() const noexcept { return m_data; }
+
+        private:
+            T* m_data;
+            size_t m_count;
+        };
+
+        // Merges the sorted [left, left + left_count) and [right, right + right_count) into out by
+        // moving. Big merges split around the middle of the longer run, so both halves are parallel.
+        template <typename T, typename Compare>
+        void merge_runs(thread_pool& pool, size_t grain, T* left, size_t left_count, T* right, size_t right_count,
+                        T* out, Compare& comp) {
+            if(left_count + right_count <= grain) {
+                std::merge(std::make_move_iterator(left), std::make_move_iterator(left + left_count),
+                           std::make_move_iterator(right), std::make_move_iterator(right + right_count), out, comp);
+                return;
+            }
+            if(left_count < right_count) {
+                std::swap(left, right);
+                std::swap(left_count, right_count);
+            }
+            size_t pivot = left_count / 2;
+            size_t split = std::lower_bound(right, right + right_count, left[pivot], comp) - right;
+            out[pivot + split] = std::move(left[pivot]);
+            pool.join([&] { merge_runs(pool, grain, left, pivot, right, split, out, comp); },
+                      [&] {
+                          merge_runs(pool, grain, left + pivot + 1, left_count - pivot - 1, right + split,
+                                     right_count - split, out + pivot + split + 1, comp);
+                      });
+        }
+
+        // Sorts data[0, count); the result ends up in data, or in buffer when to_buffer is set.
+        // The halves are sorted into the other array, so every level merges across the two.
+        template <typename T, typename Compare>
+        void merge_sort(thread_pool& pool, size_t grain, T* data, T* buffer, size_t count, bool to_buffer,
+                        Compare& comp) {
+            if(count <= grain) {
+                std::sort(data, data + count, comp);
+                if(to_buffer) std::move(data, data + count, buffer);
+                return;
+            }
+            size_t half = count / 2;
+            pool.join([&] { merge_sort(pool, grain, data, buffer, half, !to_buffer, comp); },
+                      [&] { merge_sort(pool, grain, data + half, buffer + half, count - half, !to_buffer, comp); });
+            T* from = to_buffer ? data : buffer;
+            T* to = to_buffer ? buffer : data;
+            merge_runs(pool, grain, from, half, from + half, count - half, to, comp);
+        }
+    } // namespace detail
+
+    template <std::contiguous_iterator It, typename Function>
+    void for_each(const policy& exec, It first, It last, Function f) {
+        auto data = std::to_address(first);
+        size_t count = last - first;
+        exec.pool->parallel_for(0, count, exec.grain_for(count), [data, &f](size_t begin, size_t end) {
+            for(size_t i = begin; i < end; ++i) f(data[i]);
+        });
+    }
+
+    template <std::contiguous_iterator It, typename Function>
+    void for_each(It first, It last, Function f) {
+        for_each(policy{}, first, last, std::move(f));
+    }
+
+    template <std::contiguous_iterator It, std::contiguous_iterator Out, typename UnaryOp>
+    Out transform(const policy& exec, It first, It last, Out d_first, UnaryOp op) {
+        auto in = std::to_address(first);
+        auto out = std::to_address(d_first);
+        size_t count = last - first;
+        exec.pool->parallel_for(0, count, exec.grain_for(count), [in, out, &op](size_t begin, size_t end) {
+            for(size_t i = begin; i < end; ++i) out[i] = op(in[i]);
+        });
+        return d_first + count;
+    }
+
+    template <std::contiguous_iterator It, std::contiguous_iterator Out, typename UnaryOp>
+    Out transform(It first, It last, Out d_first, UnaryOp op) {
+        return transform(policy{}, first, last, d_first, std::move(op));
+    }
+
+    template <std::contiguous_iterator It1, std::contiguous_iterator It2, std::contiguous_iterator Out,
+              typename BinaryOp>
+    Out transform(const policy& exec, It1 first1, It1 last1, It2 first2, Out d_first, BinaryOp op) {
+        auto in1 = std::to_address(first1);
+        auto in2 = std::to_address(first2);
+        auto out = std::to_address(d_first);
+        size_t count = last1 - first1;
+        exec.pool->parallel_for(0, count, exec.grain_for(count), [in1, in2, out, &op](size_t begin, size_t end) {
+            for(size_t i = begin; i < end; ++i) out[i] = op(in1[i], in2[i]);
+        });
+        return d_first + count;
+    }
+
+    template <std::contiguous_iterator It1, std::contiguous_iterator It2, std::contiguous_iterator Out,
+              typename BinaryOp>
+    Out transform(It1 first1, It1 last1, It2 first2, Out d_first, BinaryOp op) {
+        return transform(policy{}, first1, last1, first2, d_first, std::move(op));
+    }
+
+    // Folds every chunk left to right and then the chunk results in order, so op has to be
+    // associative but not commutative.
+    template <std::contiguous_iterator It, typename T, typename BinaryOp = std::plus<>>
+    T reduce(const policy& exec, It first, It last, T init, BinaryOp op = {}) {
+        auto data = std::to_address(first);
+        detail::chunking split{size_t(last - first), exec.grain_for(last - first)};
+        if(split.count == 0) return init;
+        s21::vector<std::optional<T>> partial(split.chunks());
+        exec.pool->parallel_for(0, partial.size(), 1, [&](size_t begin, size_t end) {
+            for(size_t chunk = begin; chunk < end; ++chunk) {
+                size_t i = split.begin(chunk);
+                T sum = data[i];
+                for(++i; i < split.end(chunk); ++i) sum = op(std::move(sum), data[i]);
+                partial[chunk].emplace(std::move(sum));
+            }
+        });
+        for(std::optional<T>& sum : partial) init = op(std::move(init), std::move(*sum));
+        return init;
+    }
+
+    template <std::contiguous_iterator It, typename T, typename BinaryOp = std::plus<>>
+    T reduce(It first, It last, T init, BinaryOp op = {}) {
+        return reduce(policy{}, first, last, std::move(init), std::move(op));
+    }
+
+    // Two passes: chunk totals in parallel, a short serial scan over the totals, then every chunk
+    // scans again starting from the total of the chunks before it. Totals are folded left to right,
+    // so as for reduce() op only has to be associative. d_first may equal first.
+    template <std::contiguous_iterator It, std::contiguous_iterator Out, typename BinaryOp = std::plus<>>
+    Out inclusive_scan(const policy& exec, It first, It last, Out d_first, BinaryOp op = {}) {
+        using T = std::iter_value_t<It>;
+        auto in = std::to_address(first);
+        auto out = std::to_address(d_first);
+        detail::chunking split{size_t(last - first), exec.grain_for(last - first)};
+        if(split.count == 0) return d_first;
+        s21::vector<std::optional<T>> carry(split.chunks());
+        exec.pool->parallel_for(0, carry.size() - 1, 1, [&](size_t begin, size_t end) {
+            for(size_t chunk = begin; chunk < end; ++chunk)
+                carry[chunk + 1].emplace(std::accumulate(in + split.begin(chunk) + 1, in + split.end(chunk),
+                                                         T(in[split.begin(chunk)]), op));
+        });
+        for(size_t chunk = 2; chunk < carry.size(); ++chunk) carry[chunk] = op(*carry[chunk - 1], *carry[chunk]);
+        exec.pool->parallel_for(0, carry.size(), 1, [&](size_t begin, size_t end) {
+            for(size_t chunk = begin; chunk < end; ++chunk) {
+                auto from = in + split.begin(chunk);
+                auto to = in + split.end(chunk);
+                if(chunk == 0)
+                    std::inclusive_scan(from, to, out, op);
+                else
+                    std::inclusive_scan(from, to, out + split.begin(chunk), op, *carry[chunk]);
+            }
+        });
+        return d_first + split.count;
+    }
+
+    template <std::contiguous_iterator It, std::contiguous_iterator Out, typename BinaryOp = std::plus<>>
+    Out inclusive_scan(It first, It last, Out d_first, BinaryOp op = {}) {
+        return inclusive_scan(policy{}, first, last, d_first, std::move(op));
+    }
+
+    // Stable partition: chunks count their matches, the counts give every chunk its output offsets
+    // on both sides, and the elements are moved out to a buffer and back. Returns the first element
+    // of the second group.
+    template <std::contiguous_iterator It, typename Predicate>
+    It partition(const policy& exec, It first, It last, Predicate pred) {
+        using T = std::iter_value_t<It>;
+        static_assert(detail::nothrow_movable<T>, "parallel::partition moves elements through a buffer");
+        auto data = std::to_address(first);
+        detail::chunking split{size_t(last - first), exec.grain_for(last - first)};
+        if(split.count == 0) return first;
+        s21::vector<size_t> matches(split.chunks() + 1);
+        s21::vector<unsigned char> keep(split.count);
+        exec.pool->parallel_for(0, split.chunks(), 1, [&](size_t begin, size_t end) {
+            for(size_t chunk = begin; chunk < end; ++chunk) {
+                size_t count = 0;
+                for(size_t i = split.begin(chunk); i < split.end(chunk); ++i) {
+                    keep[i] = pred(data[i]) ? 1 : 0;
+                    count += keep[i];
+                }
+                matches[chunk + 1] = count;
+            }
+        });
+        std::partial_sum(matches.begin(), matches.end(), matches.begin());
+        size_t total = matches.back();
+
+        detail::scratch_buffer<T> buffer(split.count);
+        T* moved = buffer.data();
+        exec.pool->parallel_for(0, split.chunks(), 1, [&](size_t begin, size_t end) {
+            for(size_t chunk = begin; chunk < end; ++chunk) {
+                size_t yes = matches[chunk];
+                size_t no = total + split.begin(chunk) - matches[chunk];
+                for(size_t i = split.begin(chunk); i < split.end(chunk); ++i)
+                    std::construct_at(moved + (keep[i] ? yes++ : no++), std::move(data[i]));
+            }
+        });
+        exec.pool->parallel_for(0, split.count, split.grain, [&](size_t begin, size_t end) {
+            for(size_t i = begin; i < end; ++i) data[i] = std::move(moved[i]);
+            std::destroy(moved + begin, moved + end);
+        });
+        return first + total;
+    }
+
+    template <std::contiguous_iterator It, typename Predicate>
+    It partition(It first, It last, Predicate pred) {
+        return partition(policy{}, first, last, std::move(pred));
+    }
+
+    // Merge sort: the elements are moved out to a scratch buffer, runs of grain elements are sorted
+    // with std::sort, and merging level by level brings them back, with big merges split in
+    // parallel too. Not stable.
+    template <std::contiguous_iterator It, typename Compare = std::less<>>
+    void sort(const policy& exec, It first, It last, Compare comp = {}) {
+        using T = std::iter_value_t<It>;
+        static_assert(detail::nothrow_movable<T>, "parallel::sort moves elements through a buffer");
+        size_t count = last - first;
+        size_t grain = exec.grain_for(count);
+        T* data = std::to_address(first);
+        if(count <= grain) {
+            std::sort(data, data + count, comp);
+            return;
+        }
+        detail::scratch_buffer<T> buffer(count);
+        T* scratch = buffer.data();
+        exec.pool->parallel_for(0, count, grain, [&](size_t begin, size_t end) {
+            std::uninitialized_move(data + begin, data + end, scratch + begin);
+        });
+        auto destroy = [&] {
+            exec.pool->parallel_for(0, count, grain,
+                                    [&](size_t begin, size_t end) { std::destroy(scratch + begin, scratch + end); });
+        };
+        try {
+            detail::merge_sort(*exec.pool, grain, scratch, data, count, true, comp);
+        }
+        catch(...) {
+            destroy();
+            throw;
+        }
+        destroy();
+    }
+
+    template <std::contiguous_iterator It, typename Compare = std::less<>>
+    void sort(It first, It last, Compare comp = {}) {
+        sort(policy{}, first, last, std::move(comp));
+    }
+} // namespace s21::parallel
+
+#endif
@@ -0,0 +1,188 @@
+#ifndef S21_CONTAINERS_THREAD_POOL
+#define S21_CONTAINERS_THREAD_POOL
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "./../deque/s21_deque.h"
+#include "./../vector/s21_vector.h"
+
+namespace s21::parallel {
+    // Fork-join thread pool with work stealing. Every worker owns a task deque: it pushes and pops
+    // at the back (newest first, which keeps its working set in cache) while idle workers steal
+    // from the front of other deques (oldest first, which tends to be the biggest piece of work).
+    //
+    // join(a, b) is the only scheduling primitive: it offers b to thieves, runs a, then runs b
+    // itself unless it was stolen. A thread waiting for a stolen task keeps executing other tasks
+    // instead of blocking, so nested joins cannot deadlock and a pool with a single thread works.
+    //
+    // A pool of size n starts n - 1 workers: the thread that calls into the pool is the n-th.
+    class thread_pool {
+    private:
+        using task = std::function<void()>;
+
+        struct m_Queue {
+            std::mutex mutex;
+            s21::deque<task> tasks;
+        };
+
+        // One queue per worker plus a shared one for threads outside the pool.
+        s21::vector<std::unique_ptr<m_Queue>> m_queues;
+        s21::vector<std::thread> m_threads;
+        std::atomic<size_t> m_queued;
+        std::atomic<size_t> m_sleeping;
+        std::atomic<bool> m_stop;
+        std::mutex m_sleep_mutex;
+        std::condition_variable m_wake;
+
+        static inline thread_local const thread_pool* t_pool = nullptr;
+        static inline thread_local size_t t_index = 0;
+
+        size_t own_queue() const noexcept { return t_pool == this ? t_index : m_queues.size() - 1; }
+
+        void push(task work) {
+            m_Queue& queue = *m_queues[own_queue()];
+            {
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                queue.tasks.push_back(std::move(work));
+            }
+            m_queued.fetch_add(1);
+            if(m_sleeping.load() > 0) {
+                std::lock_guard<std::mutex> lock(m_sleep_mutex);
+                m_wake.notify_one();
+            }
+        }
+
+        bool pop_back(size_t index, task& work) {
+            m_Queue& queue = *m_queues[index];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if(queue.tasks.empty()) return false;
+            work = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            return true;
+        }
+
+        bool pop_front(size_t index, task& work) {
+            m_Queue& queue = *m_queues[index];
+            std::unique_lock<std::mutex> lock(queue.mutex, std::try_to_lock);
+            if(!lock.owns_lock() || queue.tasks.empty()) return false;
+            work = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            return true;
+        }
+
+        // Runs one task: the newest of the own queue, else the oldest of someone else's.
+        bool run_one() {
+            if(m_queued.load() == 0) return false;
+            size_t own = own_queue();
+            task work;
+            bool found = pop_back(own, work);
+            for(size_t step = 1; !found && step < m_queues.size(); ++step)
+                found = pop_front((own + step) % m_queues.size(), work);
+            if(!found) return false;
+            m_queued.fetch_sub(1);
+            work();
+            return true;
+        }
+
+        void wait_for(const std::atomic<bool>& done) {
+            while(!done.load(std::memory_order_acquire)) {
+                if(!run_one()) std::this_thread::yield();
+            }
+        }
+
+        void worker_loop(size_t index) {
+            t_pool = this;
+            t_index = index;
+            while(true) {
+                if(run_one()) continue;
+                std::unique_lock<std::mutex> lock(m_sleep_mutex);
+                m_sleeping.fetch_add(1);
+                m_wake.wait(lock, [this] { return m_stop.load() || m_queued.load() > 0; });
+                m_sleeping.fetch_sub(1);
+                if(m_stop.load() && m_queued.load() == 0) return;
+            }
+        }
+
+    public:
+        explicit thread_pool(size_t threads = std::max(1u, std::thread::hardware_concurrency())) :
+            m_queued(0), m_sleeping(0), m_stop(false) {
+            threads = std::max<size_t>(threads, 1);
+            for(size_t i = 0; i < threads; ++i) m_queues.emplace_back(std::make_unique<m_Queue>());
+            for(size_t i = 0; i + 1 < threads; ++i) m_threads.emplace_back([this, i] { worker_loop(i); });
+        }
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        ~thread_pool() {
+            {
+                std::lock_guard<std::mutex> lock(m_sleep_mutex);
+                m_stop.store(true);
+            }
+            m_wake.notify_all();
+            for(std::thread& thread : m_threads) thread.join();
+        }
+
+        // Number of threads that execute tasks, counting the caller.
+        size_t size() const noexcept { return m_threads.size() + 1; }
+
+        // Pool shared by the parallel algorithms unless they are given another one.
+        static thread_pool& global() {
+            static thread_pool pool;
+            return pool;
+        }
+
+        // Runs first and second, possibly in parallel, and returns when both are done. An exception
+        // from either is rethrown here once both have finished.
+        template <typename First, typename Second>
+        void join(First&& first, Second&& second) {
+            // Two references keep the task inside std::function's small buffer, so a join allocates
+            // only when the queue grows.
+            struct {
+                std::atomic<bool> done{false};
+                std::exception_ptr error;
+            } state;
+            push([&second, &state] {
+                try {
+                    second();
+                }
+                catch(...) {
+                    state.error = std::current_exception();
+                }
+                state.done.store(true, std::memory_order_release);
+            });
+            try {
+                first();
+            }
+            catch(...) {
+                wait_for(state.done);
+                throw;
+            }
+            wait_for(state.done);
+            if(state.error) std::rethrow_exception(state.error);
+        }
+
+        // Calls body(begin, end) on pieces of [first, last) no longer than grain, splitting in halves.
+        template <typename Body>
+        void parallel_for(size_t first, size_t last, size_t grain, const Body& body) {
+            grain = std::max<size_t>(grain, 1);
+            if(last - first <= grain) {
+                if(first < last) body(first, last);
+                return;
+            }
+            size_t middle = first + (last - first) / 2;
+            join([&] { parallel_for(first, middle, grain, body); }, [&] { parallel_for(middle, last, grain, body); });
+        }
+    };
+} // namespace s21::parallel
+
+#endif
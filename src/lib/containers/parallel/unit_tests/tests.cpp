@@ -0,0 +1,272 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "./../../array/s21_array.h"
+#include "./../../vector/s21_vector.h"
+#include "./../s21_parallel.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+namespace {
+    s21::vector<int> shuffled(size_t n, unsigned seed = 7) {
+        s21::vector<int> v(n);
+        std::iota(v.begin(), v.end(), 0);
+        std::shuffle(v.begin(), v.end(), std::mt19937(seed));
+        return v;
+    }
+
+    template <typename Left, typename Right>
+    bool same(const Left& left, const Right& right) {
+        return std::equal(left.begin(), left.end(), right.begin(), right.end());
+    }
+} // namespace
+
+TEST(threadPoolTest, SizeCountsCaller) {
+    parallel::thread_pool single(1);
+    EXPECT_EQ(single.size(), 1u);
+    parallel::thread_pool four(4);
+    EXPECT_EQ(four.size(), 4u);
+    parallel::thread_pool zero(0);
+    EXPECT_EQ(zero.size(), 1u);
+}
+
+TEST(threadPoolTest, JoinRunsBoth) {
+    parallel::thread_pool pool(3);
+    int a = 0;
+    int b = 0;
+    pool.join([&] { a = 1; }, [&] { b = 2; });
+    EXPECT_EQ(a, 1);
+    EXPECT_EQ(b, 2);
+}
+
+TEST(threadPoolTest, NestedJoinsDoNotDeadlock) {
+    parallel::thread_pool pool(4);
+    std::function<long(int)> fib = [&](int n) -> long {
+        if(n < 2) return n;
+        long x = 0;
+        long y = 0;
+        pool.join([&] { x = fib(n - 1); }, [&] { y = fib(n - 2); });
+        return x + y;
+    };
+    EXPECT_EQ(fib(20), 6765);
+}
+
+TEST(threadPoolTest, WorkIsSpreadOverThreads) {
+    parallel::thread_pool pool(4);
+    std::atomic<size_t> calls(0);
+    std::atomic<bool> foreign(false);
+    std::thread::id caller = std::this_thread::get_id();
+    pool.parallel_for(0, 64, 1, [&](size_t, size_t) {
+        ++calls;
+        if(std::this_thread::get_id() != caller) foreign = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    });
+    EXPECT_EQ(calls.load(), 64u);
+    EXPECT_TRUE(foreign.load());
+}
+
+TEST(threadPoolTest, ParallelForCoversRangeOnce) {
+    parallel::thread_pool pool(4);
+    const size_t n = 10007;
+    std::unique_ptr<std::atomic<int>[]> hits(new std::atomic<int>[n]());
+    pool.parallel_for(0, n, 100, [&](size_t begin, size_t end) {
+        EXPECT_LE(end - begin, 100u);
+        for(size_t i = begin; i < end; ++i) ++hits[i];
+    });
+    for(size_t i = 0; i < n; ++i) EXPECT_EQ(hits[i].load(), 1);
+    pool.parallel_for(5, 5, 1, [](size_t, size_t) { FAIL(); });
+}
+
+TEST(threadPoolTest, ExceptionReachesCaller) {
+    parallel::thread_pool pool(4);
+    EXPECT_THROW(pool.parallel_for(0, 1000, 10,
+                                   [](size_t begin, size_t) {
+                                       if(begin >= 500) throw std::runtime_error("task");
+                                   }),
+                 std::runtime_error);
+    int first = 0;
+    int second = 0;
+    pool.join([&] { ++first; }, [&] { ++second; });
+    EXPECT_EQ(first + second, 2);
+}
+
+TEST(parallelTest, SortMatchesStd) {
+    parallel::thread_pool pool(4);
+    for(size_t grain : {1u, 7u, 64u, 1000u}) {
+        s21::vector<int> v = shuffled(20000);
+        parallel::sort({&pool, grain}, v.begin(), v.end());
+        EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+        EXPECT_EQ(v.front(), 0);
+        EXPECT_EQ(v.back(), 19999);
+    }
+}
+
+TEST(parallelTest, SortWithComparatorAndDuplicates) {
+    parallel::thread_pool pool(3);
+    s21::vector<int> v(5000);
+    std::mt19937 random(3);
+    for(int& x : v) x = static_cast<int>(random() % 50);
+    s21::vector<int> expected = v;
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+    parallel::sort({&pool, 100}, v.begin(), v.end(), std::greater<>());
+    EXPECT_TRUE(same(v, expected));
+}
+
+TEST(parallelTest, SortStrings) {
+    parallel::thread_pool pool(4);
+    s21::vector<std::string> v;
+    for(int i : shuffled(3000)) v.push_back("key" + std::to_string(i));
+    s21::vector<std::string> expected = v;
+    std::sort(expected.begin(), expected.end());
+    parallel::sort({&pool, 50}, v.begin(), v.end());
+    EXPECT_TRUE(same(v, expected));
+}
+
+TEST(parallelTest, SortSmallAndEmpty) {
+    s21::vector<int> empty;
+    parallel::sort(empty.begin(), empty.end());
+    s21::array<int, 5> a({5, 3, 1, 4, 2});
+    parallel::sort(a.begin(), a.end());
+    EXPECT_TRUE(std::is_sorted(a.begin(), a.end()));
+}
+
+TEST(parallelTest, SortRethrowsComparatorException) {
+    parallel::thread_pool pool(4);
+    s21::vector<std::string> v;
+    for(int i : shuffled(2000)) v.push_back(std::to_string(i));
+    int calls = 0;
+    std::mutex mutex;
+    auto comp = [&](const std::string& a, const std::string& b) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(++calls == 5000) throw std::runtime_error("compare");
+        return a < b;
+    };
+    EXPECT_THROW(parallel::sort({&pool, 64}, v.begin(), v.end(), comp), std::runtime_error);
+    EXPECT_EQ(v.size(), 2000u);
+}
+
+TEST(parallelTest, TransformUnaryAndBinary) {
+    parallel::thread_pool pool(4);
+    s21::vector<int> x = shuffled(10000);
+    s21::vector<long> y(x.size());
+    auto end = parallel::transform({&pool, 128}, x.begin(), x.end(), y.begin(), [](int v) { return 2L * v; });
+    EXPECT_EQ(end, y.end());
+    for(size_t i = 0; i < x.size(); ++i) EXPECT_EQ(y[i], 2L * x[i]);
+
+    s21::vector<long> z(x.size());
+    parallel::transform({&pool, 128}, x.begin(), x.end(), y.begin(), z.begin(), std::plus<>());
+    for(size_t i = 0; i < x.size(); ++i) EXPECT_EQ(z[i], 3L * x[i]);
+}
+
+TEST(parallelTest, ForEachInPlace) {
+    parallel::thread_pool pool(4);
+    s21::vector<int> v;
+    v.assign(9999, 1);
+    parallel::for_each({&pool, 10}, v.begin(), v.end(), [](int& x) { x += 41; });
+    EXPECT_TRUE(std::all_of(v.begin(), v.end(), [](int x) { return x == 42; }));
+}
+
+TEST(parallelTest, ReduceKeepsOrder) {
+    parallel::thread_pool pool(4);
+    s21::vector<int> v(100000);
+    std::iota(v.begin(), v.end(), 1);
+    EXPECT_EQ(parallel::reduce({&pool, 333}, v.begin(), v.end(), 0L), 5000050000L);
+    EXPECT_EQ(parallel::reduce({&pool, 333}, v.begin(), v.begin(), 7L), 7L);
+
+    // Concatenation is associative but not commutative.
+    s21::vector<std::string> words;
+    std::string expected = "start";
+    for(int i = 0; i < 500; ++i) {
+        words.push_back(std::to_string(i) + ",");
+        expected += words.back();
+    }
+    EXPECT_EQ(parallel::reduce({&pool, 16}, words.begin(), words.end(), std::string("start")), expected);
+}
+
+TEST(parallelTest, InclusiveScanMatchesStd) {
+    parallel::thread_pool pool(4);
+    s21::vector<long> v(12345);
+    std::mt19937 random(11);
+    for(long& x : v) x = static_cast<long>(random() % 100);
+    s21::vector<long> expected(v.size());
+    std::inclusive_scan(v.begin(), v.end(), expected.begin());
+
+    s21::vector<long> out(v.size());
+    EXPECT_EQ(parallel::inclusive_scan({&pool, 100}, v.begin(), v.end(), out.begin()), out.end());
+    EXPECT_TRUE(same(out, expected));
+
+    parallel::inclusive_scan({&pool, 77}, v.begin(), v.end(), v.begin());
+    EXPECT_TRUE(same(v, expected));
+}
+
+TEST(parallelTest, InclusiveScanCustomOp) {
+    parallel::thread_pool pool(2);
+    s21::vector<int> v = shuffled(5000);
+    s21::vector<int> expected(v.size());
+    std::inclusive_scan(v.begin(), v.end(), expected.begin(), [](int a, int b) { return std::max(a, b); });
+    parallel::inclusive_scan({&pool, 64}, v.begin(), v.end(), v.begin(), [](int a, int b) { return std::max(a, b); });
+    EXPECT_TRUE(same(v, expected));
+
+    // Concatenation is associative but not commutative.
+    s21::vector<std::string> words;
+    for(int i = 0; i < 500; ++i) words.push_back(std::to_string(i) + ",");
+    s21::vector<std::string> prefixes(words.size());
+    std::inclusive_scan(words.begin(), words.end(), prefixes.begin());
+    s21::vector<std::string> out(words.size());
+    parallel::inclusive_scan({&pool, 16}, words.begin(), words.end(), out.begin());
+    EXPECT_TRUE(same(out, prefixes));
+}
+
+TEST(parallelTest, PartitionIsStable) {
+    parallel::thread_pool pool(4);
+    s21::vector<int> v = shuffled(20000);
+    s21::vector<int> expected = v;
+    auto even = [](int x) { return x % 2 == 0; };
+    std::stable_partition(expected.begin(), expected.end(), even);
+    auto middle = parallel::partition({&pool, 500}, v.begin(), v.end(), even);
+    EXPECT_EQ(middle - v.begin(), 10000);
+    EXPECT_TRUE(same(v, expected));
+}
+
+TEST(parallelTest, PartitionEdgeCases) {
+    parallel::thread_pool pool(2);
+    s21::vector<std::string> v({"a", "bb", "c", "dd"});
+    auto none = parallel::partition({&pool, 1}, v.begin(), v.end(), [](const std::string&) { return false; });
+    EXPECT_EQ(none, v.begin());
+    auto all = parallel::partition({&pool, 1}, v.begin(), v.end(), [](const std::string&) { return true; });
+    EXPECT_EQ(all, v.end());
+    auto longer =
+        parallel::partition({&pool, 1}, v.begin(), v.end(), [](const std::string& s) { return s.size() > 1; });
+    EXPECT_EQ(longer - v.begin(), 2);
+    EXPECT_TRUE(same(v, s21::vector<std::string>({"bb", "dd", "a", "c"})));
+    s21::vector<int> empty;
+    EXPECT_EQ(parallel::partition(empty.begin(), empty.end(), [](int) { return true; }), empty.end());
+}
+
+TEST(parallelTest, DefaultPolicyUsesGlobalPool) {
+    parallel::policy exec;
+    EXPECT_EQ(exec.pool, &parallel::thread_pool::global());
+    EXPECT_GE(exec.grain_for(10), 4096u);
+    EXPECT_EQ((parallel::policy{exec.pool, 5}.grain_for(1000000)), 5u);
+    s21::vector<int> v = shuffled(100000);
+    parallel::sort(v.begin(), v.end());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
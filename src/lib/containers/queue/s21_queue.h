@@ -3,12 +3,17 @@
 
 #include <cstddef>
 #include <initializer_list>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 
 #include "./../array/s21_array.h"
+#include "./../deque/s21_deque.h"
 #include "./../list/s21_list.h"
 namespace s21 {
-    template <typename T, typename container = list<T>>
+    // The default s21::deque pops its front in O(1) and hands the emptied block to the tail, so a
+    // queue of steady length stops allocating. s21::list fits as well.
+    template <typename T, typename container = deque<T>>
     class queue {
     public:
         using value_type = T;
@@ -21,6 +26,10 @@ namespace s21 {
 
     public:
         queue() : m_data() {};
+        // Passes alloc on to the underlying container when it is allocator-aware.
+        template <typename Alloc>
+            requires std::uses_allocator_v<container, Alloc>
+        explicit queue(const Alloc& alloc) : m_data(alloc) {};
         explicit queue(std::initializer_list<value_type> const& items) : m_data(items) {};
         queue(const queue& s) : m_data(s.m_data) {};
         queue(queue&& s) noexcept : m_data(std::move(s.m_data)) {};
@@ -58,6 +67,12 @@ namespace s21 {
         }
     };
 
+    // Queue over a pmr::deque.
+    namespace pmr {
+        template <typename T>
+        using queue = s21::queue<T, pmr::deque<T>>;
+    } // namespace pmr
+
 } // namespace s21
 
 #endif
@@ -141,6 +141,15 @@ TEST(QueueTest, InsertManyBack) {
     EXPECT_EQ(q.size(), 7);
 }
 
+TEST(QueueTest, ListBackedQueue) {
+    queue<int, s21::list<int>> q{1, 2};
+    q.push(3);
+    q.pop();
+    EXPECT_EQ(q.front(), 2);
+    EXPECT_EQ(q.back(), 3);
+    EXPECT_EQ(q.size(), 2);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     UTIL(RUN_ALL_TESTS());
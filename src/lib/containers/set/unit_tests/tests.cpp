@@ -3,7 +3,10 @@
 //
 #include <gtest/gtest.h>
 
+#include <memory_resource>
+
 #include "./../s21_set.h"
+#include "./../testing_include/counting_resource.h"
 #include "./../testing_include/test_include.h"
 
 using namespace s21;
@@ -497,6 +500,28 @@ TEST(SetEraseTest, EraseRoot3) {
     EXPECT_EQ(s.find(50), s.end());
     EXPECT_EQ(*s.find(10), 10);
 }
+TEST(SetTest, FingerSearch) {
+    set<int> s{1, 5, 9, 13, 17};
+    auto it = s.lower_bound(6);
+    EXPECT_EQ(*it, 9);
+    EXPECT_EQ(*s.upper_bound(9), 13);
+    EXPECT_EQ(*s.lower_bound(it, 10), 13);
+    EXPECT_EQ(*s.find(it, 17), 17);
+    EXPECT_EQ(*s.lower_bound(it, 0), 1);
+    EXPECT_TRUE(s.lower_bound(it, 18) == s.end());
+    EXPECT_TRUE(s.find(it, 2) == s.end());
+}
+
+TEST(SetTest, PmrSetInMonotonicArena) {
+    char buffer[8192];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    s21::pmr::set<int> s(&arena);
+    for(int i = 0; i < 50; ++i) s.insert(i % 25);
+    EXPECT_EQ(s.size(), (size_t) 25);
+    EXPECT_TRUE(s.contains(24));
+    EXPECT_EQ(s.get_allocator().resource(), &arena);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     UTIL(RUN_ALL_TESTS());
@@ -0,0 +1,82 @@
+// Throughput of every SIMD kernel under each instruction set the CPU supports, from the scalar
+// loops up to AVX-512, for 8-bit, 32-bit and floating point elements. The buffer fits in L2 so that
+// the numbers show the kernels rather than memory bandwidth; pass a bigger count to see the latter.
+// find looks for a value that is absent, so it scans the whole buffer.
+//
+// Usage: bench_s21_simd [element_count] [rounds]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "./../../vector/s21_vector.h"
+#include "./../s21_simd.h"
+
+namespace {
+    template <typename Body>
+    double measure(Body body) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(stop - start).count();
+    }
+
+    void report(const char* type, const char* set, const char* kernel, size_t ops, double seconds) {
+        std::printf("%-8s %-8s %-10s %10.2f Mops/s\n", type, set, kernel, ops / seconds / 1e6);
+    }
+
+    template <typename T>
+    void run(const char* type, size_t n, size_t rounds) {
+        s21::vector<T> x(n);
+        s21::vector<T> y(n);
+        for(size_t i = 0; i < n; ++i) x[i] = y[i] = static_cast<T>(i % 100);
+        const T absent = static_cast<T>(101);
+        size_t ops = n * rounds;
+        double sink = 0;
+
+        for(s21::simd::isa set : {s21::simd::isa::scalar, s21::simd::isa::sse2, s21::simd::isa::avx2,
+                                  s21::simd::isa::avx512}) {
+            if(set > s21::simd::detected_isa()) break;
+            s21::simd::use_isa(set);
+            const char* name = s21::simd::isa_name(set);
+            report(type, name, "find", ops, measure([&] {
+                       for(size_t r = 0; r < rounds; ++r) sink += double(s21::simd::find(x, absent) - x.begin());
+                   }));
+            report(type, name, "count", ops, measure([&] {
+                       for(size_t r = 0; r < rounds; ++r) sink += double(s21::simd::count(x, T(7)));
+                   }));
+            report(type, name, "min", ops, measure([&] {
+                       for(size_t r = 0; r < rounds; ++r) sink += double(s21::simd::min(x));
+                   }));
+            report(type, name, "max", ops, measure([&] {
+                       for(size_t r = 0; r < rounds; ++r) sink += double(s21::simd::max(x));
+                   }));
+            report(type, name, "sum", ops, measure([&] {
+                       for(size_t r = 0; r < rounds; ++r) sink += double(s21::simd::sum(x));
+                   }));
+            report(type, name, "equal", ops, measure([&] {
+                       for(size_t r = 0; r < rounds; ++r) sink += s21::simd::equal(x, y);
+                   }));
+            report(type, name, "fill", ops, measure([&] {
+                       for(size_t r = 0; r < rounds; ++r) s21::simd::fill(y, static_cast<T>(r % 100));
+                   }));
+            std::copy(x.begin(), x.end(), y.begin());
+        }
+        s21::simd::use_isa(s21::simd::detected_isa());
+        if(sink == 42) std::printf("\n");
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 16384;
+    size_t rounds = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20000;
+
+    std::printf("%zu elements x %zu rounds, detected %s\n", n, rounds, s21::simd::isa_name(s21::simd::detected_isa()));
+    run<uint8_t>("uint8_t", n, rounds);
+    run<int32_t>("int32_t", n, rounds);
+    run<float>("float", n, rounds);
+    run<double>("double", n, rounds);
+    return 0;
+}
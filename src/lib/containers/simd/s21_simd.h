@@ -0,0 +1,424 @@
+#ifndef S21_CONTAINERS_SIMD
+#define S21_CONTAINERS_SIMD
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+// GCC and Clang vector extensions let every kernel be written once for any register width; each
+// instruction set gets an entry point compiled with its target attribute, and the widest one the
+// CPU supports is picked at run time. Elsewhere the kernels are plain loops.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define S21_SIMD_X86 1
+#define S21_SIMD_INLINE inline __attribute__((always_inline))
+#define S21_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#define S21_SIMD_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl")))
+#endif
+
+namespace s21::simd {
+    enum class isa { scalar, sse2, avx2, avx512 };
+
+    inline const char* isa_name(isa set) noexcept {
+        switch(set) {
+            case isa::sse2:
+                return "sse2";
+            case isa::avx2:
+                return "avx2";
+            case isa::avx512:
+                return "avx512";
+            default:
+                return "scalar";
+        }
+    }
+
+    // Widest instruction set both the CPU and this build support.
+    inline isa detected_isa() noexcept {
+#ifdef S21_SIMD_X86
+        static const isa detected = [] {
+            __builtin_cpu_init();
+            if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+               __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl"))
+                return isa::avx512;
+            if(__builtin_cpu_supports("avx2")) return isa::avx2;
+            return isa::sse2;
+        }();
+        return detected;
+#else
+        return isa::scalar;
+#endif
+    }
+
+    namespace detail {
+        inline std::atomic<isa>& active() noexcept {
+            static std::atomic<isa> set(detected_isa());
+            return set;
+        }
+    } // namespace detail
+
+    // Instruction set the kernels dispatch to.
+    inline isa active_isa() noexcept { return detail::active().load(std::memory_order_relaxed); }
+
+    // Caps dispatch at the given instruction set, e.g. to compare them; asking for more than the
+    // CPU has yields the detected one. Returns the set now in use.
+    inline isa use_isa(isa set) noexcept {
+        if(set > detected_isa()) set = detected_isa();
+        detail::active().store(set, std::memory_order_relaxed);
+        return set;
+    }
+
+    // Element types the kernels handle: integers and floating point of 1 to 8 bytes. Floating point
+    // compares follow ==, so 0.0 matches -0.0 and NaN matches nothing.
+    template <typename T>
+    concept vectorizable = std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+                           (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+    namespace detail {
+        template <size_t Size>
+        using lane_t = std::conditional_t<Size == 1, uint8_t,
+                                          std::conditional_t<Size == 2, uint16_t,
+                                                             std::conditional_t<Size == 4, uint32_t, uint64_t>>>;
+
+        // Scalar versions, used without SIMD support and for the tails of the vector kernels.
+        template <typename T>
+        struct scalar_kernels {
+            static size_t find(const T* data, size_t size, T value) noexcept {
+                size_t i = 0;
+                while(i < size && !(data[i] == value)) ++i;
+                return i;
+            }
+
+            static size_t count(const T* data, size_t size, T value) noexcept {
+                size_t matches = 0;
+                for(size_t i = 0; i < size; ++i) matches += data[i] == value;
+                return matches;
+            }
+
+            static T min(const T* data, size_t size) noexcept {
+                T best = data[0];
+                for(size_t i = 1; i < size; ++i) best = data[i] < best ? data[i] : best;
+                return best;
+            }
+
+            static T max(const T* data, size_t size) noexcept {
+                T best = data[0];
+                for(size_t i = 1; i < size; ++i) best = best < data[i] ? data[i] : best;
+                return best;
+            }
+
+            static T sum(const T* data, size_t size) noexcept {
+                // Integers wrap instead of overflowing.
+                using acc = std::conditional_t<std::is_integral_v<T>, lane_t<sizeof(T)>, T>;
+                acc total = 0;
+                for(size_t i = 0; i < size; ++i) total += static_cast<acc>(data[i]);
+                return static_cast<T>(total);
+            }
+
+            static void fill(T* data, size_t size, T value) noexcept {
+                for(size_t i = 0; i < size; ++i) data[i] = value;
+            }
+
+            static bool equal(const T* left, const T* right, size_t size) noexcept {
+                for(size_t i = 0; i < size; ++i) {
+                    if(!(left[i] == right[i])) return false;
+                }
+                return true;
+            }
+        };
+
+#ifdef S21_SIMD_X86
+        // The kernels for registers of Width bytes. Vectors never pass through a function signature
+        // by value: a 256 or 512-bit vector argument outside an AVX function would change the ABI.
+        template <size_t Width, typename T>
+        struct kernels {
+            using lane = lane_t<sizeof(T)>;
+            using acc = std::conditional_t<std::is_integral_v<T>, lane, T>;
+            typedef T vec __attribute__((vector_size(Width)));
+            typedef lane mask __attribute__((vector_size(Width)));
+            typedef acc acc_vec __attribute__((vector_size(Width)));
+
+            static constexpr size_t lanes = Width / sizeof(T);
+            // Four registers per step keep several loads in flight and amortize the match test.
+            static constexpr size_t step = 4 * lanes;
+
+            static S21_SIMD_INLINE void load(vec& out, const T* data) noexcept { std::memcpy(&out, data, Width); }
+
+            static S21_SIMD_INLINE bool any(const mask& bits) noexcept {
+                uint64_t words[Width / 8];
+                std::memcpy(words, &bits, Width);
+                uint64_t merged = 0;
+                for(size_t i = 0; i < Width / 8; ++i) merged |= words[i];
+                return merged != 0;
+            }
+
+            // Matches of value in data[0, step), as all-ones lanes.
+            static S21_SIMD_INLINE void matches(mask& out, const T* data, const vec& needle) noexcept {
+                vec x0, x1, x2, x3;
+                load(x0, data);
+                load(x1, data + lanes);
+                load(x2, data + 2 * lanes);
+                load(x3, data + 3 * lanes);
+                out = (mask)(x0 == needle) | (mask)(x1 == needle) | (mask)(x2 == needle) | (mask)(x3 == needle);
+            }
+
+            static S21_SIMD_INLINE size_t find(const T* data, size_t size, T value) noexcept {
+                vec needle = vec{} + value;
+                size_t i = 0;
+                for(; i + step <= size; i += step) {
+                    mask hits;
+                    matches(hits, data + i, needle);
+                    if(any(hits)) return i + scalar_kernels<T>::find(data + i, step, value);
+                }
+                return i + scalar_kernels<T>::find(data + i, size - i, value);
+            }
+
+            static S21_SIMD_INLINE size_t count(const T* data, size_t size, T value) noexcept {
+                // Lanes count matches by subtracting all-ones masks, so every lane narrower than 8 bytes
+                // is emptied into the total before it can wrap.
+                constexpr size_t flush = sizeof(T) == 1   ? UINT8_MAX
+                                         : sizeof(T) == 2 ? UINT16_MAX
+                                         : sizeof(T) == 4 ? UINT32_MAX
+                                                          : SIZE_MAX;
+                vec needle = vec{} + value;
+                size_t total = 0;
+                size_t i = 0;
+                while(i + lanes <= size) {
+                    mask counters = mask{};
+                    for(size_t round = 0; round < flush && i + lanes <= size; ++round, i += lanes) {
+                        vec x;
+                        load(x, data + i);
+                        counters -= (mask)(x == needle);
+                    }
+                    for(size_t l = 0; l < lanes; ++l) total += counters[l];
+                }
+                return total + scalar_kernels<T>::count(data + i, size - i, value);
+            }
+
+            template <bool Max>
+            static S21_SIMD_INLINE T extreme(const T* data, size_t size) noexcept {
+                if(size < lanes) return Max ? scalar_kernels<T>::max(data, size) : scalar_kernels<T>::min(data, size);
+                vec best;
+                load(best, data);
+                size_t i = lanes;
+                for(; i + lanes <= size; i += lanes) {
+                    vec x;
+                    load(x, data + i);
+                    best = (Max ? best < x : x < best) ? x : best;
+                }
+                // The last, possibly overlapping, register covers the tail.
+                vec x;
+                load(x, data + size - lanes);
+                best = (Max ? best < x : x < best) ? x : best;
+                T result = best[0];
+                for(size_t l = 1; l < lanes; ++l)
+                    result = (Max ? result < best[l] : best[l] < result) ? best[l] : result;
+                return result;
+            }
+
+            static S21_SIMD_INLINE T sum(const T* data, size_t size) noexcept {
+                acc_vec s0 = acc_vec{}, s1 = acc_vec{}, s2 = acc_vec{}, s3 = acc_vec{};
+                size_t i = 0;
+                for(; i + step <= size; i += step) {
+                    acc_vec x0, x1, x2, x3;
+                    std::memcpy(&x0, data + i, Width);
+                    std::memcpy(&x1, data + i + lanes, Width);
+                    std::memcpy(&x2, data + i + 2 * lanes, Width);
+                    std::memcpy(&x3, data + i + 3 * lanes, Width);
+                    s0 += x0;
+                    s1 += x1;
+                    s2 += x2;
+                    s3 += x3;
+                }
+                s0 = (s0 + s1) + (s2 + s3);
+                acc total = 0;
+                for(size_t l = 0; l < lanes; ++l) total += s0[l];
+                return static_cast<T>(total + static_cast<acc>(scalar_kernels<T>::sum(data + i, size - i)));
+            }
+
+            // Stores that straddle two cache lines cost twice, so after one unaligned store at the
+            // front the loop continues from the first aligned address, and one more unaligned store
+            // covers the tail. Bytes go to memset, which the C library already tunes per CPU.
+            static S21_SIMD_INLINE void fill(T* data, size_t size, T value) noexcept {
+                if constexpr(sizeof(T) == 1) {
+                    std::memset(data, static_cast<uint8_t>(value), size);
+                    return;
+                }
+                if(size < lanes) return scalar_kernels<T>::fill(data, size, value);
+                vec filler = vec{} + value;
+                std::memcpy(data, &filler, Width);
+                size_t i = (Width - reinterpret_cast<uintptr_t>(data) % Width) % Width / sizeof(T);
+                for(; i + lanes <= size; i += lanes) std::memcpy(data + i, &filler, Width);
+                std::memcpy(data + size - lanes, &filler, Width);
+            }
+
+            static S21_SIMD_INLINE bool equal(const T* left, const T* right, size_t size) noexcept {
+                size_t i = 0;
+                for(; i + step <= size; i += step) {
+                    mask differ = mask{};
+                    for(size_t r = 0; r < 4; ++r) {
+                        vec x, y;
+                        load(x, left + i + r * lanes);
+                        load(y, right + i + r * lanes);
+                        differ |= ~(mask)(x == y);
+                    }
+                    if(any(differ)) return false;
+                }
+                return scalar_kernels<T>::equal(left + i, right + i, size - i);
+            }
+        };
+
+        // One entry point per instruction set; each instantiates the kernels under its target so
+        // the vector code inlined into it uses that register width.
+#define S21_SIMD_ENTRY_POINTS(Name, Target, Width)                                                                     \
+    template <typename T>                                                                                              \
+    struct Name {                                                                                                      \
+        Target static size_t find(const T* data, size_t size, T value) noexcept {                                      \
+            return kernels<Width, T>::find(data, size, value);                                                         \
+        }                                                                                                              \
+        Target static size_t count(const T* data, size_t size, T value) noexcept {                                     \
+            return kernels<Width, T>::count(data, size, value);                                                        \
+        }                                                                                                              \
+        Target static T min(const T* data, size_t size) noexcept {                                                     \
+            return kernels<Width, T>::template extreme<false>(data, size);                                             \
+        }                                                                                                              \
+        Target static T max(const T* data, size_t size) noexcept {                                                     \
+            return kernels<Width, T>::template extreme<true>(data, size);                                              \
+        }                                                                                                              \
+        Target static T sum(const T* data, size_t size) noexcept { return kernels<Width, T>::sum(data, size); }        \
+        Target static void fill(T* data, size_t size, T value) noexcept {                                              \
+            kernels<Width, T>::fill(data, size, value);                                                                \
+        }                                                                                                              \
+        Target static bool equal(const T* left, const T* right, size_t size) noexcept {                                \
+            return kernels<Width, T>::equal(left, right, size);                                                        \
+        }                                                                                                              \
+    };
+
+        S21_SIMD_ENTRY_POINTS(sse2_kernels, , 16)
+        S21_SIMD_ENTRY_POINTS(avx2_kernels, S21_SIMD_TARGET_AVX2, 32)
+        S21_SIMD_ENTRY_POINTS(avx512_kernels, S21_SIMD_TARGET_AVX512, 64)
+#undef S21_SIMD_ENTRY_POINTS
+#endif
+
+        // Calls call(Kernels{}) with the kernel set for the active instruction set.
+        template <typename T, typename Call>
+        decltype(auto) dispatch(Call&& call) {
+#ifdef S21_SIMD_X86
+            switch(active_isa()) {
+                case isa::avx512:
+                    return call(avx512_kernels<T>{});
+                case isa::avx2:
+                    return call(avx2_kernels<T>{});
+                case isa::sse2:
+                    return call(sse2_kernels<T>{});
+                default:
+                    break;
+            }
+#endif
+            return call(scalar_kernels<T>{});
+        }
+
+        template <typename R>
+        concept vectorizable_range = std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+                                     vectorizable<std::ranges::range_value_t<R>>;
+    } // namespace detail
+
+    // Pointer to the first element equal to value, or last.
+    template <vectorizable T>
+    const T* find(const T* first, const T* last, std::type_identity_t<T> value) noexcept {
+        return first + detail::dispatch<T>([&](auto kernels) { return kernels.find(first, last - first, value); });
+    }
+
+    template <vectorizable T>
+    T* find(T* first, T* last, std::type_identity_t<T> value) noexcept {
+        return const_cast<T*>(find(static_cast<const T*>(first), static_cast<const T*>(last), value));
+    }
+
+    template <vectorizable T>
+    size_t count(const T* first, const T* last, std::type_identity_t<T> value) noexcept {
+        return detail::dispatch<T>([&](auto kernels) { return kernels.count(first, last - first, value); });
+    }
+
+    template <vectorizable T>
+    bool contains(const T* first, const T* last, std::type_identity_t<T> value) noexcept {
+        return find(first, last, value) != last;
+    }
+
+    // Smallest and largest element of a non-empty range. With NaNs in the data the result is unspecified.
+    template <vectorizable T>
+    T min(const T* first, const T* last) noexcept {
+        return detail::dispatch<T>([&](auto kernels) { return kernels.min(first, last - first); });
+    }
+
+    template <vectorizable T>
+    T max(const T* first, const T* last) noexcept {
+        return detail::dispatch<T>([&](auto kernels) { return kernels.max(first, last - first); });
+    }
+
+    // Sum in T: integers wrap around, floating point is added in several running sums at once, so
+    // rounding may differ from a left-to-right loop.
+    template <vectorizable T>
+    T sum(const T* first, const T* last) noexcept {
+        return detail::dispatch<T>([&](auto kernels) { return kernels.sum(first, last - first); });
+    }
+
+    template <vectorizable T>
+    void fill(T* first, T* last, std::type_identity_t<T> value) noexcept {
+        detail::dispatch<T>([&](auto kernels) { kernels.fill(first, last - first, value); });
+    }
+
+    template <vectorizable T>
+    bool equal(const T* first1, const T* last1, const T* first2) noexcept {
+        return detail::dispatch<T>([&](auto kernels) { return kernels.equal(first1, first2, last1 - first1); });
+    }
+
+    // The same operations over contiguous containers: s21::vector, s21::array, std::span and the like.
+    template <detail::vectorizable_range R>
+    auto find(R&& range, std::ranges::range_value_t<R> value) {
+        auto first = std::ranges::data(range);
+        return std::ranges::begin(range) + (find(first, first + std::ranges::size(range), value) - first);
+    }
+
+    template <detail::vectorizable_range R>
+    size_t count(const R& range, std::ranges::range_value_t<R> value) noexcept {
+        return count(std::ranges::data(range), std::ranges::data(range) + std::ranges::size(range), value);
+    }
+
+    template <detail::vectorizable_range R>
+    bool contains(const R& range, std::ranges::range_value_t<R> value) noexcept {
+        return contains(std::ranges::data(range), std::ranges::data(range) + std::ranges::size(range), value);
+    }
+
+    template <detail::vectorizable_range R>
+    auto min(const R& range) noexcept {
+        return min(std::ranges::data(range), std::ranges::data(range) + std::ranges::size(range));
+    }
+
+    template <detail::vectorizable_range R>
+    auto max(const R& range) noexcept {
+        return max(std::ranges::data(range), std::ranges::data(range) + std::ranges::size(range));
+    }
+
+    template <detail::vectorizable_range R>
+    auto sum(const R& range) noexcept {
+        return sum(std::ranges::data(range), std::ranges::data(range) + std::ranges::size(range));
+    }
+
+    template <detail::vectorizable_range R>
+    void fill(R&& range, std::ranges::range_value_t<R> value) noexcept {
+        fill(std::ranges::data(range), std::ranges::data(range) + std::ranges::size(range), value);
+    }
+
+    // Same size and equal elements.
+    template <detail::vectorizable_range R1, detail::vectorizable_range R2>
+        requires std::is_same_v<std::ranges::range_value_t<R1>, std::ranges::range_value_t<R2>>
+    bool equal(const R1& left, const R2& right) noexcept {
+        size_t size = std::ranges::size(left);
+        return size == std::ranges::size(right) &&
+               equal(std::ranges::data(left), std::ranges::data(left) + size, std::ranges::data(right));
+    }
+} // namespace s21::simd
+
+#endif
@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <span>
+
+#include "./../../array/s21_array.h"
+#include "./../../vector/s21_vector.h"
+#include "./../s21_simd.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+namespace {
+    // Restores the detected instruction set when a test is done with it.
+    struct IsaScope {
+        explicit IsaScope(simd::isa set) { simd::use_isa(set); }
+        ~IsaScope() { simd::use_isa(simd::detected_isa()); }
+    };
+
+    // Every instruction set this CPU can run, narrowest first.
+    s21::vector<simd::isa> runnable_isas() {
+        s21::vector<simd::isa> sets;
+        for(simd::isa set : {simd::isa::scalar, simd::isa::sse2, simd::isa::avx2, simd::isa::avx512}) {
+            if(set <= simd::detected_isa()) sets.push_back(set);
+        }
+        return sets;
+    }
+
+    // Checks every kernel against the std algorithms on all lengths up to 300 and on misaligned
+    // starts, so the vector body, the unrolled steps and the scalar tails are all exercised.
+    template <typename T>
+    void check_against_std() {
+        std::mt19937 random(5);
+        s21::vector<T> data(320);
+        for(T& x : data) x = static_cast<T>(random() % 100);
+        for(simd::isa set : runnable_isas()) {
+            IsaScope scope(set);
+            SCOPED_TRACE(simd::isa_name(set));
+            for(size_t offset = 0; offset < 3; ++offset) {
+                for(size_t size = 0; size + offset <= 300; size += size < 70 ? 1 : 23) {
+                    const T* first = data.data() + offset;
+                    const T* last = first + size;
+                    for(T value : {T(0), T(42), T(99), T(100)}) {
+                        ASSERT_EQ(simd::find(first, last, value), std::find(first, last, value));
+                        ASSERT_EQ(simd::count(first, last, value), size_t(std::count(first, last, value)));
+                        ASSERT_EQ(simd::contains(first, last, value), std::find(first, last, value) != last);
+                    }
+                    if(size == 0) continue;
+                    ASSERT_EQ(simd::min(first, last), *std::min_element(first, last));
+                    ASSERT_EQ(simd::max(first, last), *std::max_element(first, last));
+                    T expected = std::accumulate(first, last, T(0), [](T a, T b) { return static_cast<T>(a + b); });
+                    if constexpr(std::is_floating_point_v<T>)
+                        ASSERT_NEAR(simd::sum(first, last), expected, 1e-3);
+                    else
+                        ASSERT_EQ(simd::sum(first, last), expected);
+                }
+            }
+        }
+    }
+} // namespace
+
+TEST(simdTest, DetectedIsaIsActiveByDefault) {
+    EXPECT_EQ(simd::active_isa(), simd::detected_isa());
+#ifdef S21_SIMD_X86
+    EXPECT_GE(simd::detected_isa(), simd::isa::sse2);
+#endif
+    IsaScope scope(simd::isa::avx512);
+    EXPECT_EQ(simd::active_isa(), simd::detected_isa());
+    EXPECT_EQ(simd::use_isa(simd::isa::scalar), simd::isa::scalar);
+    EXPECT_STREQ(simd::isa_name(simd::active_isa()), "scalar");
+}
+
+TEST(simdTest, Int8) { check_against_std<int8_t>(); }
+TEST(simdTest, Uint16) { check_against_std<uint16_t>(); }
+TEST(simdTest, Int32) { check_against_std<int32_t>(); }
+TEST(simdTest, Uint32) { check_against_std<uint32_t>(); }
+TEST(simdTest, Int64) { check_against_std<int64_t>(); }
+TEST(simdTest, Float) { check_against_std<float>(); }
+TEST(simdTest, Double) { check_against_std<double>(); }
+
+TEST(simdTest, ExtremesAndSignedValues) {
+    s21::vector<int32_t> v(1000);
+    std::iota(v.begin(), v.end(), -500);
+    v[777] = std::numeric_limits<int32_t>::min();
+    v[3] = std::numeric_limits<int32_t>::max();
+    for(simd::isa set : runnable_isas()) {
+        IsaScope scope(set);
+        EXPECT_EQ(simd::min(v), std::numeric_limits<int32_t>::min());
+        EXPECT_EQ(simd::max(v), std::numeric_limits<int32_t>::max());
+    }
+}
+
+TEST(simdTest, CountDoesNotWrapNarrowLanes) {
+    s21::vector<uint8_t> bytes(100000);
+    simd::fill(bytes, 7);
+    bytes[12345] = 8;
+    for(simd::isa set : runnable_isas()) {
+        IsaScope scope(set);
+        EXPECT_EQ(simd::count(bytes, 7), 99999u);
+        EXPECT_EQ(simd::sum(bytes), uint8_t(99999 * 7 + 8));
+    }
+}
+
+TEST(simdTest, IntegerSumWraps) {
+    s21::vector<int32_t> v(64);
+    simd::fill(v, std::numeric_limits<int32_t>::max());
+    int32_t expected = static_cast<int32_t>(uint32_t(std::numeric_limits<int32_t>::max()) * 64u);
+    for(simd::isa set : runnable_isas()) {
+        IsaScope scope(set);
+        EXPECT_EQ(simd::sum(v), expected);
+    }
+}
+
+TEST(simdTest, FloatingPointEqualityFollowsOperator) {
+    s21::vector<double> v(100);
+    simd::fill(v, 1.5);
+    v[70] = -0.0;
+    v[80] = std::nan("");
+    for(simd::isa set : runnable_isas()) {
+        IsaScope scope(set);
+        EXPECT_EQ(simd::find(v, 0.0) - v.begin(), 70);
+        EXPECT_FALSE(simd::contains(v, std::nan("")));
+        EXPECT_EQ(simd::count(v, 1.5), 98u);
+        EXPECT_FALSE(simd::equal(v, v));
+    }
+}
+
+TEST(simdTest, FillAndEqual) {
+    for(simd::isa set : runnable_isas()) {
+        IsaScope scope(set);
+        for(size_t size : {0u, 1u, 15u, 16u, 17u, 100u, 1001u}) {
+            s21::vector<int16_t> a(size + 2);
+            s21::vector<int16_t> b(size + 2);
+            simd::fill(a.data() + 1, a.data() + 1 + size, int16_t(-3));
+            std::fill(b.data() + 1, b.data() + 1 + size, int16_t(-3));
+            EXPECT_EQ(a.front(), 0);
+            EXPECT_EQ(a.back(), 0);
+            EXPECT_TRUE(simd::equal(a, b));
+            if(size == 0) continue;
+            b[1 + size / 2] = 4;
+            EXPECT_FALSE(simd::equal(a, b));
+            EXPECT_FALSE(simd::equal(a.data(), a.data() + a.size() - 1, b.data()));
+        }
+    }
+}
+
+TEST(simdTest, RangesOverContainers) {
+    s21::array<float, 40> a;
+    simd::fill(a, 2.5f);
+    a[33] = -1.0f;
+    EXPECT_EQ(simd::find(a, -1.0f) - a.begin(), 33);
+    EXPECT_EQ(simd::find(a, 7.0f), a.end());
+    EXPECT_EQ(simd::min(a), -1.0f);
+    EXPECT_EQ(simd::max(a), 2.5f);
+    EXPECT_FLOAT_EQ(simd::sum(a), 39 * 2.5f - 1.0f);
+
+    s21::vector<int64_t> v(50);
+    std::iota(v.begin(), v.end(), 1);
+    std::span<const int64_t> view(v.data(), v.size());
+    EXPECT_EQ(simd::sum(view), 1275);
+    EXPECT_TRUE(simd::contains(view, 50));
+    EXPECT_FALSE(simd::equal(v, std::span<const int64_t>(v.data(), 49)));
+    *simd::find(v, 25) = 0;
+    EXPECT_EQ(simd::count(v, 0), 1u);
+}
+
+TEST(simdTest, ArrayFillUsesKernels) {
+    s21::array<int32_t, 1000> a;
+    a.fill(9);
+    EXPECT_EQ(simd::count(a, 9), 1000u);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "./../s21_small_map.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+TEST(smallMapTest, DefaultConstructor) {
+    small_map<int, int, 4> m;
+    EXPECT_TRUE(m.empty());
+    EXPECT_TRUE(m.is_inline());
+    EXPECT_TRUE(m.begin() == m.end());
+}
+
+TEST(smallMapTest, InlineInsertKeepsOrder) {
+    small_map<int, int, 4> m{{3, 30}, {1, 10}, {4, 40}, {2, 20}};
+    EXPECT_TRUE(m.is_inline());
+    EXPECT_EQ(m.size(), (size_t) 4);
+    int expected = 1;
+    for(auto it = m.begin(); it != m.end(); ++it) {
+        EXPECT_EQ(it->first, expected);
+        EXPECT_EQ(it->second, expected * 10);
+        ++expected;
+    }
+}
+
+TEST(smallMapTest, DuplicateKeyRejected) {
+    small_map<int, int, 4> m{{1, 10}};
+    auto res = m.insert(1, 99);
+    EXPECT_FALSE(res.second);
+    EXPECT_EQ(res.first->second, 10);
+    m.insert_or_assign(1, 99);
+    EXPECT_EQ(m.at(1), 99);
+    EXPECT_EQ(m.size(), (size_t) 1);
+}
+
+TEST(smallMapTest, PromotesPastCapacity) {
+    small_map<int, int, 4> m;
+    for(int i = 10; i > 0; --i) m.insert(i, i * i);
+    EXPECT_FALSE(m.is_inline());
+    EXPECT_EQ(m.size(), (size_t) 10);
+    int expected = 1;
+    for(const auto& item : m) {
+        EXPECT_EQ(item.first, expected);
+        EXPECT_EQ(item.second, expected * expected);
+        ++expected;
+    }
+    EXPECT_EQ(m[7], 49);
+}
+
+TEST(smallMapTest, FindAndBounds) {
+    small_map<int, int, 8> m{{2, 0}, {4, 0}, {6, 0}};
+    EXPECT_TRUE(m.contains(4));
+    EXPECT_FALSE(m.contains(5));
+    EXPECT_TRUE(m.find(5) == m.end());
+    EXPECT_EQ(m.lower_bound(3)->first, 4);
+    EXPECT_EQ(m.upper_bound(4)->first, 6);
+    EXPECT_TRUE(m.lower_bound(7) == m.end());
+}
+
+TEST(smallMapTest, EraseInlineAndPromoted) {
+    small_map<int, int, 3> m{{1, 1}, {2, 2}, {3, 3}};
+    m.erase(m.find(2));
+    EXPECT_EQ(m.size(), (size_t) 2);
+    EXPECT_FALSE(m.contains(2));
+    for(int i = 4; i < 8; ++i) m.insert(i, i);
+    m.erase(m.find(5));
+    EXPECT_FALSE(m.contains(5));
+    EXPECT_EQ(m.size(), (size_t) 5);
+}
+
+TEST(smallMapTest, OperatorBracketInserts) {
+    small_map<std::string, int, 2> m;
+    m["b"] = 2;
+    m["a"] = 1;
+    m["c"] = 3;
+    EXPECT_FALSE(m.is_inline());
+    EXPECT_EQ(m.begin()->first, "a");
+    EXPECT_EQ(m["c"], 3);
+}
+
+TEST(smallMapTest, CopyAndMove) {
+    small_map<std::string, int, 4> inline_map{{"x", 1}, {"y", 2}};
+    small_map<std::string, int, 4> big;
+    for(int i = 0; i < 10; ++i) big.insert(std::to_string(i), i);
+
+    small_map<std::string, int, 4> copy_inline(inline_map);
+    small_map<std::string, int, 4> copy_big(big);
+    EXPECT_TRUE(copy_inline == inline_map);
+    EXPECT_TRUE(copy_big == big);
+
+    small_map<std::string, int, 4> moved(std::move(copy_big));
+    EXPECT_TRUE(moved == big);
+    EXPECT_TRUE(copy_big.empty());
+
+    moved = inline_map;
+    EXPECT_TRUE(moved.is_inline());
+    EXPECT_TRUE(moved == inline_map);
+}
+
+TEST(smallMapTest, SwapMixed) {
+    small_map<int, std::string, 4> a{{1, "one"}};
+    small_map<int, std::string, 4> b;
+    for(int i = 0; i < 6; ++i) b.insert(i, std::to_string(i));
+    a.swap(b);
+    EXPECT_EQ(a.size(), (size_t) 6);
+    EXPECT_FALSE(a.is_inline());
+    EXPECT_EQ(b.size(), (size_t) 1);
+    EXPECT_TRUE(b.is_inline());
+    EXPECT_EQ(b.at(1), "one");
+}
+
+TEST(smallMapTest, ClearReturnsToInline) {
+    small_map<int, int, 2> m{{1, 1}, {2, 2}, {3, 3}};
+    EXPECT_FALSE(m.is_inline());
+    m.clear();
+    EXPECT_TRUE(m.empty());
+    EXPECT_TRUE(m.is_inline());
+    m.insert(5, 5);
+    EXPECT_TRUE(m.is_inline());
+}
+
+TEST(smallMapTest, MergeAndInsertMany) {
+    small_map<int, int, 4> a{{1, 1}, {3, 3}};
+    small_map<int, int, 4> b{{2, 2}, {3, 30}};
+    a.merge(b);
+    EXPECT_EQ(a.size(), (size_t) 3);
+    EXPECT_EQ(a.at(3), 3);
+    EXPECT_TRUE(b.empty());
+    auto res = a.insert_many(std::pair<const int, int>{4, 4}, std::pair<const int, int>{1, 0});
+    EXPECT_TRUE(res[0].second);
+    EXPECT_FALSE(res[1].second);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
@@ -0,0 +1,74 @@
+#ifndef S21_CONTAINERS_SMALL_SET
+#define S21_CONTAINERS_SMALL_SET
+
+#include <functional>
+
+#include "./../tree/s21_small_tree.h"
+#include "./../vector/s21_vector.h"
+
+namespace s21 {
+    // set with the first N keys stored inline in the object (see SmallTree).
+    template <typename TKey, size_t N = 16, typename Compare = std::less<TKey>>
+    class small_set {
+    private:
+        SmallTree<TKey, TKey, N, Compare, const TKey> m_tree;
+
+    public:
+        using key_type = TKey;
+        using value_type = TKey;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using iterator = typename SmallTree<TKey, TKey, N, Compare, const TKey>::iterator;
+        using const_iterator = typename SmallTree<TKey, TKey, N, Compare, const TKey>::const_iterator;
+        using size_type = size_t;
+
+        small_set() = default;
+
+        explicit small_set(std::initializer_list<TKey> const& list) {
+            for(const auto& value : list) insert(value);
+        }
+
+        small_set(const small_set& other) = default;
+        small_set(small_set&& other) noexcept = default;
+
+        small_set& operator=(const small_set& other) = default;
+        small_set& operator=(small_set&& other) noexcept = default;
+
+        bool operator==(const small_set& other) const { return m_tree == other.m_tree; }
+        ~small_set() = default;
+
+        iterator begin() const { return m_tree.begin(); }
+        iterator end() const { return m_tree.end(); }
+        bool empty() const { return m_tree.empty(); }
+        size_type size() const { return m_tree.size(); }
+        size_type max_size() const { return m_tree.max_size(); }
+        void clear() { m_tree.clear(); }
+
+        // True while the keys still live in the inline array.
+        bool is_inline() const { return m_tree.is_inline(); }
+
+        std::pair<iterator, bool> insert(const value_type& value) { return m_tree.insert_unique(value, value); }
+
+        // cppcheck-suppress passedByValue
+        void erase(iterator pos) { m_tree.erase(pos); }
+        void swap(small_set& other) noexcept { m_tree.swap(other.m_tree); }
+        void merge(small_set& other) {
+            if(this == &other) return;
+            for(iterator it = other.begin(); it != other.end(); ++it) { insert(*it); }
+            other.clear();
+        }
+        iterator find(const key_type& key) const { return m_tree.find(key); }
+        bool contains(const key_type& key) const { return m_tree.contains(key); }
+
+        iterator lower_bound(const key_type& key) const { return m_tree.lower_bound(key); }
+        iterator upper_bound(const key_type& key) const { return m_tree.upper_bound(key); }
+
+        template <typename... Args>
+        s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+            s21::vector<std::pair<iterator, bool>> result;
+            (result.push_back(insert(std::forward<Args>(args))), ...);
+            return result;
+        }
+    };
+} // namespace s21
+#endif
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "./../s21_small_set.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+namespace {
+    // Key whose copy throws once the shared countdown reaches zero.
+    struct FragileKey {
+        static inline int countdown = -1;
+        int value;
+
+        explicit FragileKey(int v) : value(v) {}
+
+        FragileKey(const FragileKey& other) : value(other.value) {
+            if(countdown >= 0 && countdown-- == 0) throw std::runtime_error("FragileKey");
+        }
+
+        FragileKey& operator=(const FragileKey&) = default;
+
+        bool operator<(const FragileKey& other) const { return value < other.value; }
+    };
+} // namespace
+
+TEST(smallSetTest, DefaultConstructor) {
+    small_set<int, 4> s;
+    EXPECT_TRUE(s.empty());
+    EXPECT_TRUE(s.is_inline());
+    EXPECT_EQ(s.size(), (size_t) 0);
+}
+
+TEST(smallSetTest, InlineInsertKeepsOrder) {
+    small_set<int, 8> s{5, 1, 3, 1, 4};
+    EXPECT_TRUE(s.is_inline());
+    EXPECT_EQ(s.size(), (size_t) 4);
+    int ans[] = {1, 3, 4, 5};
+    int id = 0;
+    for(int value : s) EXPECT_EQ(value, ans[id++]);
+    auto it = s.end();
+    --it;
+    EXPECT_EQ(*it, 5);
+}
+
+TEST(smallSetTest, PromotesPastCapacity) {
+    small_set<int, 4> s;
+    for(int i = 0; i < 100; ++i) s.insert((i * 37) % 100);
+    EXPECT_FALSE(s.is_inline());
+    EXPECT_EQ(s.size(), (size_t) 100);
+    int expected = 0;
+    for(int value : s) EXPECT_EQ(value, expected++);
+    EXPECT_TRUE(s.contains(99));
+    EXPECT_EQ(*s.lower_bound(50), 50);
+    EXPECT_EQ(*s.upper_bound(50), 51);
+}
+
+TEST(smallSetTest, EraseFrontMiddleBack) {
+    small_set<int, 4> s{1, 2, 3, 4};
+    s.erase(s.begin());
+    s.erase(s.find(3));
+    s.erase(s.find(4));
+    EXPECT_EQ(s.size(), (size_t) 1);
+    EXPECT_EQ(*s.begin(), 2);
+    s.erase(s.end());
+    EXPECT_EQ(s.size(), (size_t) 1);
+}
+
+TEST(smallSetTest, StringKeys) {
+    small_set<std::string, 2> s{"pear", "apple", "fig"};
+    EXPECT_FALSE(s.is_inline());
+    EXPECT_EQ(*s.begin(), "apple");
+    small_set<std::string, 2> copy(s);
+    EXPECT_TRUE(copy == s);
+    copy.clear();
+    copy.insert("kiwi");
+    EXPECT_TRUE(copy.is_inline());
+    copy.swap(s);
+    EXPECT_EQ(copy.size(), (size_t) 3);
+    EXPECT_EQ(*s.begin(), "kiwi");
+}
+
+TEST(smallSetTest, MoveAssignment) {
+    small_set<int, 4> a{1, 2};
+    small_set<int, 4> b{7, 8, 9, 10, 11};
+    a = std::move(b);
+    EXPECT_EQ(a.size(), (size_t) 5);
+    EXPECT_EQ(*a.begin(), 7);
+    EXPECT_TRUE(b.empty());
+}
+
+TEST(smallSetTest, MergeAndInsertMany) {
+    small_set<int, 4> a{1, 3};
+    small_set<int, 4> b{2, 3, 4};
+    a.merge(b);
+    EXPECT_EQ(a.size(), (size_t) 4);
+    EXPECT_TRUE(b.empty());
+    auto res = a.insert_many(5, 1);
+    EXPECT_TRUE(res[0].second);
+    EXPECT_FALSE(res[1].second);
+    EXPECT_FALSE(a.is_inline());
+}
+
+TEST(smallSetTest, ThrowDuringPromotionKeepsInlineElements) {
+    small_set<FragileKey, 4> s;
+    for(int i = 0; i < 4; ++i) s.insert(FragileKey(i));
+    FragileKey::countdown = 3;
+    EXPECT_THROW(s.insert(FragileKey(4)), std::runtime_error);
+    FragileKey::countdown = -1;
+    EXPECT_TRUE(s.is_inline());
+    EXPECT_EQ(s.size(), (size_t) 4);
+    s.insert(FragileKey(4));
+    EXPECT_FALSE(s.is_inline());
+    EXPECT_EQ(s.size(), (size_t) 5);
+    int expected = 0;
+    for(const FragileKey& key : s) EXPECT_EQ(key.value, expected++);
+    EXPECT_EQ(expected, 5);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
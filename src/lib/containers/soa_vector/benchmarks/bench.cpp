@@ -0,0 +1,105 @@
+// Scanning one field of a large record array: an s21::vector of a 32-byte struct (array of
+// structs) against an s21::soa_vector with one column per field. Summing one float of the struct
+// pulls the whole record through the cache, so it is bound by memory bandwidth; the column holds
+// only that field, densely. x += vx over two columns also vectorizes, which the strided struct
+// loop does not. Appending whole records writes to every column and is slower than the struct
+// vector. Reading two fields of each row through the proxy touches two columns, not every byte.
+//
+// Usage: bench_s21_soa_vector [record_count] [rounds]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "./../../vector/s21_vector.h"
+#include "./../s21_soa_vector.h"
+
+namespace {
+    struct Particle {
+        float x;
+        float y;
+        float z;
+        float mass;
+        float vx;
+        float vy;
+        float vz;
+        int32_t id;
+    };
+
+    using Particles = s21::soa_vector<float, float, float, float, float, float, float, int32_t>;
+
+    template <typename Body>
+    double measure(Body body) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(stop - start).count();
+    }
+
+    void report(const char* layout, const char* phase, size_t ops, double seconds) {
+        std::printf("%-12s %-24s %10.2f Mrecords/s\n", layout, phase, ops / seconds / 1e6);
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4000000;
+    size_t rounds = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 50;
+    double sink = 0;
+
+    std::printf("%zu records of %zu bytes x %zu rounds\n", n, sizeof(Particle), rounds);
+    s21::vector<Particle> aos;
+    Particles soa;
+    report("aos vector", "push_back", n, measure([&] {
+               for(size_t i = 0; i < n; ++i) {
+                   float f = static_cast<float>(i % 1000);
+                   aos.push_back({f, f, f, 1.0f, 0.5f, 0.5f, 0.5f, int32_t(i)});
+               }
+           }));
+    report("soa_vector", "push_back", n, measure([&] {
+               for(size_t i = 0; i < n; ++i) {
+                   float f = static_cast<float>(i % 1000);
+                   soa.emplace_back(f, f, f, 1.0f, 0.5f, 0.5f, 0.5f, int32_t(i));
+               }
+           }));
+
+    report("aos vector", "sum of mass", n * rounds, measure([&] {
+               for(size_t r = 0; r < rounds; ++r) {
+                   float total = 0;
+                   for(size_t i = 0; i < n; ++i) total += aos[i].mass;
+                   sink += total;
+               }
+           }));
+    report("soa_vector", "sum of mass", n * rounds, measure([&] {
+               for(size_t r = 0; r < rounds; ++r) {
+                   float total = 0;
+                   for(float mass : soa.column<3>()) total += mass;
+                   sink += total;
+               }
+           }));
+
+    report("aos vector", "x += vx", n * rounds, measure([&] {
+               for(size_t r = 0; r < rounds; ++r) {
+                   for(size_t i = 0; i < n; ++i) aos[i].x += aos[i].vx;
+               }
+           }));
+    report("soa_vector", "x += vx", n * rounds, measure([&] {
+               for(size_t r = 0; r < rounds; ++r) {
+                   float* x = soa.data<0>();
+                   const float* vx = soa.data<4>();
+                   for(size_t i = 0; i < n; ++i) x[i] += vx[i];
+               }
+           }));
+
+    report("aos vector", "proxy row read", n, measure([&] {
+               for(size_t i = 0; i < n; ++i) sink += aos[i].y + aos[i].id;
+           }));
+    report("soa_vector", "proxy row read", n, measure([&] {
+               for(size_t i = 0; i < n; ++i) {
+                   auto row = soa[i];
+                   sink += std::get<1>(row) + std::get<7>(row);
+               }
+           }));
+    if(sink == 42) std::printf("\n");
+    return 0;
+}
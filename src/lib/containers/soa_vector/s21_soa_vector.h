@@ -0,0 +1,459 @@
+#ifndef S21_CONTAINERS_SOA_VECTOR
+#define S21_CONTAINERS_SOA_VECTOR
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "./../common/s21_access.h"
+#include "./../common/s21_indexed_iterator.h"
+#include "./../vector/s21_vector.h"
+
+namespace s21 {
+    // A vector of records stored as a structure of arrays: each of Fields... lives in its own
+    // contiguous column, so a loop over one field reads only that field's bytes instead of whole
+    // records. All columns share one allocation, each starting on a 64-byte boundary, and they grow,
+    // shrink and shift together, so index i names the same record in every column.
+    //
+    // Element access goes through proxies. reference is std::tuple<Fields&...>: it converts to and
+    // is assignable from value_type (std::tuple<Fields...>), works with std::get and structured
+    // bindings, and writes through to the columns. column<I>() returns a std::span over field I for
+    // loops that the compiler (or s21::simd) can vectorize. Like vector, growth invalidates
+    // references, spans and iterators.
+    template <typename... Fields>
+    class soa_vector {
+        static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+        static_assert((std::is_object_v<Fields> && ...), "soa_vector fields must be object types");
+
+    public:
+        using value_type = std::tuple<Fields...>;
+        using reference = std::tuple<Fields&...>;
+        using const_reference = std::tuple<const Fields&...>;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+
+        template <size_t I>
+        using field_type = std::tuple_element_t<I, value_type>;
+
+        static constexpr size_type field_count = sizeof...(Fields);
+
+        // Alignment of every column; a cache line, or more if a field type asks for it.
+        static constexpr size_type column_alignment = std::max({size_type(64), alignof(Fields)...});
+
+    private:
+        using columns_type = std::tuple<Fields*...>;
+        using indices = std::index_sequence_for<Fields...>;
+
+        std::byte* m_block;
+        columns_type m_columns;
+        size_type m_size;
+        size_type m_capacity;
+
+        // Calls body(std::integral_constant<size_t, I>) for every column I in order.
+        template <typename Body>
+        static void for_each_column(Body&& body) {
+            [&]<size_t... I>(std::index_sequence<I...>) { (body(std::integral_constant<size_t, I>{}), ...); }(indices{});
+        }
+
+        static size_type round_up(size_type bytes) noexcept {
+            return (bytes + column_alignment - 1) / column_alignment * column_alignment;
+        }
+
+        static size_type block_bytes(size_type capacity) noexcept { return (round_up(sizeof(Fields) * capacity) + ...); }
+
+        // Points a column pointer at each aligned slice of block.
+        static columns_type carve(std::byte* block, size_type capacity) noexcept {
+            columns_type columns{};
+            size_type offset = 0;
+            for_each_column([&](auto column) {
+                using field = field_type<column>;
+                std::get<column>(columns) = reinterpret_cast<field*>(block + offset);
+                offset += round_up(sizeof(field) * capacity);
+            });
+            return columns;
+        }
+
+        static std::byte* allocate_block(size_type capacity) {
+            if(capacity == 0) return nullptr;
+            return static_cast<std::byte*>(::operator new(block_bytes(capacity), std::align_val_t(column_alignment)));
+        }
+
+        static void deallocate_block(std::byte* block) noexcept {
+            if(block != nullptr) ::operator delete(block, std::align_val_t(column_alignment));
+        }
+
+        template <size_t I>
+        static void destroy_column(field_type<I>* first, size_type count) noexcept {
+            if constexpr(!std::is_trivially_destructible_v<field_type<I>>) std::destroy_n(first, count);
+        }
+
+        void destroy_rows(size_type first, size_type count) noexcept {
+            for_each_column([&](auto column) { destroy_column<column>(std::get<column>(m_columns) + first, count); });
+        }
+
+        // Moves the m_size rows of every column into columns. Relocatable fields travel as bytes;
+        // others are moved when that cannot throw and copied otherwise, so a failure leaves *this
+        // intact and columns empty again.
+        void move_rows_into(const columns_type& columns) {
+            size_type done = 0;
+            try {
+                for_each_column([&](auto column) {
+                    using field = field_type<column>;
+                    field* source = std::get<column>(m_columns);
+                    field* target = std::get<column>(columns);
+                    if constexpr(is_trivially_relocatable_v<field>) {
+                        if(m_size) std::memcpy(static_cast<void*>(target), static_cast<const void*>(source), m_size * sizeof(field));
+                    } else if constexpr(std::is_nothrow_move_constructible_v<field> || !std::is_copy_constructible_v<field>) {
+                        std::uninitialized_move_n(source, m_size, target);
+                    } else {
+                        std::uninitialized_copy_n(source, m_size, target);
+                    }
+                    ++done;
+                });
+            }
+            catch(...) {
+                for_each_column([&](auto column) {
+                    if(column < done && !is_trivially_relocatable_v<field_type<column>>) {
+                        destroy_column<column>(std::get<column>(columns), m_size);
+                    }
+                });
+                throw;
+            }
+        }
+
+        // Switches to a block that move_rows_into has filled, ending the lifetime of the old rows.
+        void adopt(std::byte* block, const columns_type& columns, size_type capacity) noexcept {
+            for_each_column([&](auto column) {
+                if constexpr(!is_trivially_relocatable_v<field_type<column>>) destroy_column<column>(std::get<column>(m_columns), m_size);
+            });
+            deallocate_block(m_block);
+            m_block = block;
+            m_columns = columns;
+            m_capacity = capacity;
+        }
+
+        void reallocate(size_type new_capacity) {
+            std::byte* block = allocate_block(new_capacity);
+            columns_type columns = carve(block, new_capacity);
+            try {
+                move_rows_into(columns);
+            }
+            catch(...) {
+                deallocate_block(block);
+                throw;
+            }
+            adopt(block, columns, new_capacity);
+        }
+
+        size_type next_capacity(size_type extra) const {
+            if(extra > max_size() - m_size) throw std::length_error("soa_vector is too long");
+            return double_growth::next_capacity(m_capacity, m_size + extra, sizeof(value_type));
+        }
+
+        // Builds row index of columns from one argument per field, destroying the fields already
+        // built if a later one throws.
+        template <typename... Args>
+        static void construct_row(const columns_type& columns, size_type index, Args&&... args) {
+            size_type built = 0;
+            auto arguments = std::forward_as_tuple(std::forward<Args>(args)...);
+            try {
+                for_each_column([&](auto column) {
+                    std::construct_at(std::get<column>(columns) + index, std::get<column>(std::move(arguments)));
+                    ++built;
+                });
+            }
+            catch(...) {
+                for_each_column([&](auto column) {
+                    if(column < built) std::destroy_at(std::get<column>(columns) + index);
+                });
+                throw;
+            }
+        }
+
+        reference row(size_type index) const noexcept {
+            return std::apply([index](Fields*... columns) { return reference(columns[index]...); }, m_columns);
+        }
+
+        template <typename Tuple>
+        void append_tuple(Tuple&& record) {
+            std::apply([this](auto&&... fields) { emplace_back(std::forward<decltype(fields)>(fields)...); },
+                       std::forward<Tuple>(record));
+        }
+
+        void release() noexcept {
+            clear();
+            deallocate_block(m_block);
+            m_block = nullptr;
+            m_columns = columns_type{};
+            m_capacity = 0;
+        }
+
+        void steal(soa_vector& other) noexcept {
+            m_block = std::exchange(other.m_block, nullptr);
+            m_columns = std::exchange(other.m_columns, columns_type{});
+            m_size = std::exchange(other.m_size, 0);
+            m_capacity = std::exchange(other.m_capacity, 0);
+        }
+
+        // Dereference hook for indexed_iterator, yielding the row as a tuple of field references.
+        template <typename Self>
+        static decltype(auto) iterator_element(Self& self, size_type index) {
+            check_access(index < self.m_size, "soa_vector iterator out of range");
+            return self.row(index);
+        }
+
+        template <typename, bool, typename>
+        friend class indexed_iterator;
+
+    public:
+        using iterator = indexed_iterator<soa_vector, false, reference>;
+        using const_iterator = indexed_iterator<soa_vector, true, const_reference>;
+
+        soa_vector() noexcept : m_block(nullptr), m_columns{}, m_size(0), m_capacity(0) {}
+
+        // The constructors below delegate, so the destructor cleans up if filling throws.
+        explicit soa_vector(size_type count) : soa_vector() {
+            reserve(count);
+            for(size_type i = 0; i < count; ++i) emplace_back(Fields()...);
+        }
+
+        explicit soa_vector(std::initializer_list<value_type> const& items) : soa_vector() {
+            reserve(items.size());
+            for(const value_type& item : items) push_back(item);
+        }
+
+        soa_vector(const soa_vector& other) : soa_vector() {
+            reserve(other.m_size);
+            for(size_type i = 0; i < other.m_size; ++i) push_back(other[i]);
+        }
+
+        soa_vector(soa_vector&& other) noexcept : soa_vector() { steal(other); }
+
+        ~soa_vector() { release(); }
+
+        soa_vector& operator=(const soa_vector& other) {
+            if(this != &other) {
+                soa_vector copy(other);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        soa_vector& operator=(soa_vector&& other) noexcept {
+            if(this != &other) {
+                release();
+                steal(other);
+            }
+            return *this;
+        }
+
+        soa_vector& operator=(std::initializer_list<value_type> const& items) {
+            soa_vector copy(items);
+            swap(copy);
+            return *this;
+        }
+
+        iterator begin() noexcept { return iterator(this, 0); }
+        iterator end() noexcept { return iterator(this, m_size); }
+        const_iterator begin() const noexcept { return const_iterator(this, 0); }
+        const_iterator end() const noexcept { return const_iterator(this, m_size); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator cend() const noexcept { return end(); }
+
+        // cppcheck-suppress passedByValue
+        reference at(size_type pos) {
+            if(pos >= m_size) throw std::out_of_range("Index out of range");
+            return row(pos);
+        }
+
+        // cppcheck-suppress passedByValue
+        const_reference at(size_type pos) const {
+            if(pos >= m_size) throw std::out_of_range("Index out of range");
+            return row(pos);
+        }
+
+        // cppcheck-suppress passedByValue
+        reference operator[](size_type pos) {
+            check_access(pos < m_size, "Index out of range");
+            return row(pos);
+        }
+
+        // cppcheck-suppress passedByValue
+        const_reference operator[](size_type pos) const {
+            check_access(pos < m_size, "Index out of range");
+            return row(pos);
+        }
+
+        reference front() {
+            check_access(m_size > 0, "soa_vector is empty");
+            return row(0);
+        }
+
+        const_reference front() const {
+            check_access(m_size > 0, "soa_vector is empty");
+            return row(0);
+        }
+
+        reference back() {
+            check_access(m_size > 0, "soa_vector is empty");
+            return row(m_size - 1);
+        }
+
+        const_reference back() const {
+            check_access(m_size > 0, "soa_vector is empty");
+            return row(m_size - 1);
+        }
+
+        // Field I of every element, contiguous and aligned to column_alignment.
+        template <size_t I>
+        std::span<field_type<I>> column() noexcept {
+            return std::span<field_type<I>>(std::get<I>(m_columns), m_size);
+        }
+
+        template <size_t I>
+        std::span<const field_type<I>> column() const noexcept {
+            return std::span<const field_type<I>>(std::get<I>(m_columns), m_size);
+        }
+
+        template <size_t I>
+        field_type<I>* data() noexcept {
+            return std::get<I>(m_columns);
+        }
+
+        template <size_t I>
+        const field_type<I>* data() const noexcept {
+            return std::get<I>(m_columns);
+        }
+
+        bool empty() const noexcept { return m_size == 0; }
+
+        size_type size() const noexcept { return m_size; }
+
+        size_type capacity() const noexcept { return m_capacity; }
+
+        // cppcheck-suppress functionStatic
+        size_type max_size() const noexcept {
+            return std::numeric_limits<size_type>::max() / 2 / std::max<size_type>(sizeof(value_type), column_alignment);
+        }
+
+        // cppcheck-suppress passedByValue
+        void reserve(size_type count) {
+            if(count > max_size()) throw std::length_error("soa_vector is too long");
+            if(count > m_capacity) reallocate(count);
+        }
+
+        void shrink_to_fit() {
+            if(m_capacity > m_size) reallocate(m_size);
+        }
+
+        void clear() noexcept {
+            destroy_rows(0, m_size);
+            m_size = 0;
+        }
+
+        // Constructs one element from one argument per field. The arguments may refer to elements
+        // of this vector: on growth the row is built before the old columns go away.
+        template <typename... Args>
+            requires(sizeof...(Args) == sizeof...(Fields))
+        reference emplace_back(Args&&... args) {
+            if(m_size < m_capacity) {
+                construct_row(m_columns, m_size, std::forward<Args>(args)...);
+            } else {
+                size_type capacity = next_capacity(1);
+                std::byte* block = allocate_block(capacity);
+                columns_type columns = carve(block, capacity);
+                try {
+                    construct_row(columns, m_size, std::forward<Args>(args)...);
+                }
+                catch(...) {
+                    deallocate_block(block);
+                    throw;
+                }
+                try {
+                    move_rows_into(columns);
+                }
+                catch(...) {
+                    for_each_column([&](auto column) { std::destroy_at(std::get<column>(columns) + m_size); });
+                    deallocate_block(block);
+                    throw;
+                }
+                adopt(block, columns, capacity);
+            }
+            ++m_size;
+            return back();
+        }
+
+        // cppcheck-suppress passedByValue
+        void push_back(const value_type& value) { append_tuple(value); }
+
+        void push_back(value_type&& value) { append_tuple(std::move(value)); }
+
+        // Copies the fields of a proxy, or of any tuple with one convertible value per field. The
+        // proxy may refer to an element of this vector.
+        template <typename... Values>
+            requires(sizeof...(Values) == sizeof...(Fields))
+        void push_back(const std::tuple<Values...>& record) {
+            append_tuple(record);
+        }
+
+        void pop_back() {
+            if(empty()) throw std::out_of_range("There are nothing to pop");
+            --m_size;
+            destroy_rows(m_size, 1);
+        }
+
+        // Removes the element at pos from every column and returns the iterator to the one after it.
+        iterator erase(const_iterator pos) {
+            if(pos.m_index >= m_size) throw std::out_of_range("Erase position out of range");
+            return erase(pos, pos + 1);
+        }
+
+        // Removes [first, last) and returns the iterator to the element that followed it.
+        iterator erase(const_iterator first, const_iterator last) {
+            if(first > last || last.m_index > m_size) throw std::out_of_range("Erase range out of range");
+            size_type index = first.m_index;
+            size_type count = last.m_index - first.m_index;
+            if(count == 0) return iterator(this, index);
+            for_each_column([&](auto column) {
+                auto* data = std::get<column>(m_columns);
+                std::move(data + index + count, data + m_size, data + index);
+            });
+            destroy_rows(m_size - count, count);
+            m_size -= count;
+            return iterator(this, index);
+        }
+
+        void swap(soa_vector& other) noexcept {
+            std::swap(m_block, other.m_block);
+            std::swap(m_columns, other.m_columns);
+            std::swap(m_size, other.m_size);
+            std::swap(m_capacity, other.m_capacity);
+        }
+
+        bool operator==(const soa_vector& other) const {
+            if(m_size != other.m_size) return false;
+            bool same = true;
+            for_each_column([&](auto column) {
+                same = same && std::equal(std::get<column>(m_columns), std::get<column>(m_columns) + m_size,
+                                          std::get<column>(other.m_columns));
+            });
+            return same;
+        }
+
+        bool operator!=(const soa_vector& other) const { return !(*this == other); }
+
+    };
+} // namespace s21
+
+#endif
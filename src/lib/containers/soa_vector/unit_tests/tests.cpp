@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include "./../../simd/s21_simd.h"
+#include "./../s21_soa_vector.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+namespace {
+    // Copying throws once the shared countdown reaches zero.
+    struct Fragile {
+        static inline int countdown = -1;
+        static inline int alive = 0;
+        int value;
+
+        explicit Fragile(int v = 0) : value(v) { ++alive; }
+        Fragile(const Fragile& other) : value(other.value) {
+            if(countdown >= 0 && countdown-- == 0) throw std::runtime_error("Fragile");
+            ++alive;
+        }
+        Fragile& operator=(const Fragile&) = default;
+        ~Fragile() { --alive; }
+        bool operator==(const Fragile& other) const { return value == other.value; }
+    };
+
+    using Particles = soa_vector<float, float, int32_t>;
+} // namespace
+
+TEST(soaVectorTest, PushBackAndProxyAccess) {
+    Particles v;
+    EXPECT_TRUE(v.empty());
+    for(int i = 0; i < 1000; ++i) v.push_back({i * 0.5f, -i * 1.0f, i});
+    EXPECT_EQ(v.size(), 1000u);
+    EXPECT_GE(v.capacity(), 1000u);
+
+    auto [x, y, id] = v[10];
+    EXPECT_EQ(x, 5.0f);
+    EXPECT_EQ(y, -10.0f);
+    EXPECT_EQ(id, 10);
+    id = 77;
+    EXPECT_EQ(std::get<2>(v[10]), 77);
+
+    v[11] = std::make_tuple(1.0f, 2.0f, 3);
+    EXPECT_EQ(v.at(11), std::make_tuple(1.0f, 2.0f, 3));
+    Particles::value_type copy = v.back();
+    EXPECT_EQ(copy, std::make_tuple(499.5f, -999.0f, 999));
+    EXPECT_EQ(std::get<0>(v.front()), 0.0f);
+    EXPECT_THROW(v.at(1000), std::out_of_range);
+}
+
+TEST(soaVectorTest, ColumnsAreAlignedSpans) {
+    Particles v(100);
+    EXPECT_EQ(v.size(), 100u);
+    std::span<float> xs = v.column<0>();
+    std::span<int32_t> ids = v.column<2>();
+    EXPECT_EQ(xs.size(), 100u);
+    std::iota(ids.begin(), ids.end(), 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(v.data<0>()) % Particles::column_alignment, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(v.data<1>()) % Particles::column_alignment, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(v.data<2>()) % Particles::column_alignment, 0u);
+    EXPECT_EQ(std::get<2>(v[42]), 42);
+    simd::fill(v.column<1>(), 2.5f);
+    EXPECT_EQ(simd::sum(v.column<1>()), 250.0f);
+    EXPECT_EQ(simd::max(v.column<2>()), 99);
+    const Particles& view = v;
+    std::span<const int32_t> read_only = view.column<2>();
+    EXPECT_EQ(read_only[7], 7);
+}
+
+TEST(soaVectorTest, EraseKeepsColumnsInSync) {
+    soa_vector<int, std::string> v;
+    for(int i = 0; i < 10; ++i) v.emplace_back(i, std::to_string(i));
+    auto next = v.erase(v.begin() + 2);
+    EXPECT_EQ(std::get<0>(*next), 3);
+    next = v.erase(v.begin() + 4, v.begin() + 7);
+    EXPECT_EQ(std::get<0>(*next), 8);
+    EXPECT_EQ(v.size(), 6u);
+    for(auto [number, text] : v) EXPECT_EQ(std::to_string(number), text);
+    EXPECT_EQ(v.erase(v.end(), v.end()), v.end());
+    EXPECT_THROW(v.erase(v.end()), std::out_of_range);
+    v.pop_back();
+    EXPECT_EQ(std::get<1>(v.back()), "8");
+    v.clear();
+    EXPECT_TRUE(v.empty());
+    EXPECT_THROW(v.pop_back(), std::out_of_range);
+}
+
+TEST(soaVectorTest, IteratorsWalkRows) {
+    soa_vector<int, double> v({{1, 1.5}, {2, 2.5}, {3, 3.5}});
+    int sum = 0;
+    for(auto row : v) {
+        std::get<1>(row) *= 2;
+        sum += std::get<0>(row);
+    }
+    EXPECT_EQ(sum, 6);
+    EXPECT_EQ(std::get<1>(v[2]), 7.0);
+    soa_vector<int, double>::const_iterator it = v.begin();
+    EXPECT_EQ(std::get<0>(it[1]), 2);
+    EXPECT_EQ(v.end() - it, 3);
+    EXPECT_TRUE(it < v.end());
+    auto found = std::find_if(v.begin(), v.end(), [](auto row) { return std::get<0>(row) == 3; });
+    EXPECT_EQ(found.index(), 2u);
+}
+
+TEST(soaVectorTest, CopyMoveSwap) {
+    soa_vector<std::string, int> a({{"one", 1}, {"two", 2}});
+    soa_vector<std::string, int> b(a);
+    EXPECT_EQ(a, b);
+    std::get<1>(b[0]) = 10;
+    EXPECT_NE(a, b);
+    soa_vector<std::string, int> c(std::move(b));
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(std::get<1>(c[0]), 10);
+    b = a;
+    EXPECT_EQ(b, a);
+    c.swap(b);
+    EXPECT_EQ(c, a);
+    a = {{"three", 3}};
+    EXPECT_EQ(a.size(), 1u);
+    a = std::move(c);
+    EXPECT_EQ(std::get<0>(a.back()), "two");
+    a.reserve(100);
+    EXPECT_EQ(a.capacity(), 100u);
+    a.shrink_to_fit();
+    EXPECT_EQ(a.capacity(), 2u);
+    EXPECT_EQ(std::get<0>(a.front()), "one");
+}
+
+TEST(soaVectorTest, PushBackOfOwnElementSurvivesGrowth) {
+    soa_vector<std::string, int> v;
+    v.push_back({std::string(100, 'x'), 1});
+    for(int i = 0; i < 20; ++i) v.push_back(v[0]);
+    EXPECT_EQ(v.size(), 21u);
+    EXPECT_EQ(std::get<0>(v[20]), std::string(100, 'x'));
+    v.emplace_back(std::get<0>(v[3]), std::get<1>(v.back()));
+    EXPECT_EQ(std::get<0>(v.back()), std::string(100, 'x'));
+}
+
+TEST(soaVectorTest, MoveOnlyAndThrowingFields) {
+    soa_vector<std::unique_ptr<int>, int> owners;
+    for(int i = 0; i < 50; ++i) owners.emplace_back(std::make_unique<int>(i), i);
+    owners.erase(owners.begin());
+    EXPECT_EQ(*std::get<0>(owners.front()), 1);
+
+    Fragile::alive = 0;
+    {
+        soa_vector<int, Fragile> v;
+        for(int i = 0; i < 4; ++i) v.emplace_back(i, Fragile(i));
+        v.shrink_to_fit();
+        Fragile::countdown = 2;
+        EXPECT_THROW(v.emplace_back(4, Fragile(4)), std::runtime_error);
+        Fragile::countdown = -1;
+        EXPECT_EQ(v.size(), 4u);
+        EXPECT_EQ(std::get<1>(v[3]).value, 3);
+        EXPECT_EQ(Fragile::alive, 4);
+    }
+    EXPECT_EQ(Fragile::alive, 0);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
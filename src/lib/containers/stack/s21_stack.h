@@ -2,12 +2,17 @@
 #define S21_CONTAINERS_STACK
 
 #include <cstddef>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 
 #include "./../array/s21_array.h"
+#include "./../deque/s21_deque.h"
 #include "./../list/s21_list.h"
 namespace s21 {
-    template <typename T, typename container = list<T>>
+    // Any container with back(), push_back() and pop_back() fits, e.g. s21::vector or s21::list. The
+    // default s21::deque fills fixed-size blocks, so a push rarely allocates.
+    template <typename T, typename container = deque<T>>
     class stack {
     public:
         using value_type = T;
@@ -20,6 +25,10 @@ namespace s21 {
 
     public:
         stack() : m_data() {};
+        // Passes alloc on to the underlying container when it is allocator-aware.
+        template <typename Alloc>
+            requires std::uses_allocator_v<container, Alloc>
+        explicit stack(const Alloc& alloc) : m_data(alloc) {};
         explicit stack(std::initializer_list<value_type> const& items) : m_data(items) {};
         stack(const stack& s) : m_data(s.m_data) {};
         stack(stack&& s) noexcept : m_data(std::move(s.m_data)) {};
@@ -52,6 +61,12 @@ namespace s21 {
         }
     };
 
+    // Stack over a pmr::deque.
+    namespace pmr {
+        template <typename T>
+        using stack = s21::stack<T, pmr::deque<T>>;
+    } // namespace pmr
+
 } // namespace s21
 
 #endif
@@ -3,7 +3,10 @@
 //
 #include <gtest/gtest.h>
 
+#include <memory_resource>
+
 #include "../s21_stack.h"
+#include "./../testing_include/counting_resource.h"
 #include "./../testing_include/test_include.h"
 
 using namespace s21;
@@ -119,6 +122,31 @@ TEST(stackTest, InsertManyBack) {
     EXPECT_EQ(s1.size(), 1);
     EXPECT_EQ(s1.top(), 1);
 }
+TEST(stackTest, PmrStackPassesResourceToDeque) {
+    CountingResource resource;
+    {
+        std::pmr::polymorphic_allocator<int> alloc(&resource);
+        s21::pmr::stack<int> s(alloc);
+        for(int i = 0; i < 100; ++i) s.push(i);
+        EXPECT_EQ(s.top(), 99);
+        EXPECT_EQ(resource.allocations, (size_t) 2);
+    }
+    EXPECT_EQ(resource.live_bytes, (size_t) 0);
+}
+
+TEST(stackTest, PmrStackPassesResourceToList) {
+    CountingResource resource;
+    {
+        std::pmr::polymorphic_allocator<int> alloc(&resource);
+        s21::stack<int, s21::pmr::list<int>> s(alloc);
+        s.push(1);
+        s.push(2);
+        EXPECT_EQ(s.top(), 2);
+        EXPECT_EQ(resource.allocations, (size_t) 3);
+    }
+    EXPECT_EQ(resource.live_bytes, (size_t) 0);
+}
+
 int main(int argc, char** argv) {
     testing::InitGoogleTest(&argc, argv);
     UTIL(RUN_ALL_TESTS());
@@ -0,0 +1,26 @@
+#ifndef COUNTING_RESOURCE_H
+#define COUNTING_RESOURCE_H
+
+#include <cstddef>
+#include <memory_resource>
+
+// Forwards to the default resource and counts what passes through.
+struct CountingResource : std::pmr::memory_resource {
+    size_t allocations = 0;
+    size_t live_bytes = 0;
+
+    void* do_allocate(size_t bytes, size_t align) override {
+        ++allocations;
+        live_bytes += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t align) override {
+        live_bytes -= bytes;
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+#endif // COUNTING_RESOURCE_H
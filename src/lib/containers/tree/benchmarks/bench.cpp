@@ -0,0 +1,89 @@
+// Compares the balancing policies of BinaryTree: resulting height, key comparisons and throughput
+// for sequential inserts, random inserts, lookups and erases.
+//
+// Usage: bench_s21_tree [element_count]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "./../s21_tree.h"
+
+namespace {
+    size_t g_comparisons = 0;
+
+    struct CountingLess {
+        bool operator()(int a, int b) const {
+            ++g_comparisons;
+            return a < b;
+        }
+    };
+
+    struct Measure {
+        double seconds;
+        size_t comparisons;
+    };
+
+    template <typename Body>
+    Measure measure(Body body) {
+        g_comparisons = 0;
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto stop = std::chrono::steady_clock::now();
+        return {std::chrono::duration<double>(stop - start).count(), g_comparisons};
+    }
+
+    void report(const char* policy, const char* phase, size_t ops, const Measure& m, size_t height) {
+        std::printf("%-10s %-16s %10.2f Mops/s %8.2f cmp/op   height %zu\n", policy, phase, ops / m.seconds / 1e6,
+                    (double) m.comparisons / (double) ops, height);
+    }
+
+    template <typename Balance>
+    void run(const char* policy, const std::vector<int>& keys) {
+        using Tree = s21::BinaryTree<int, int, CountingLess, std::pair<const int, int>, Balance>;
+        const size_t n = keys.size();
+
+        {
+            Tree tree;
+            Measure m = measure([&] {
+                for(size_t i = 0; i < n; ++i) tree.insert((int) i, (int) i);
+            });
+            report(policy, "insert seq", n, m, tree.height());
+        }
+
+        Tree tree;
+        Measure insert = measure([&] {
+            for(int key : keys) tree.insert(key, key);
+        });
+        report(policy, "insert random", n, insert, tree.height());
+
+        long long checksum = 0;
+        Measure find = measure([&] {
+            for(int key : keys) checksum += tree.find(key)->second;
+        });
+        report(policy, "find random", n, find, tree.height());
+
+        Measure erase = measure([&] {
+            for(size_t i = 0; i < n; i += 2) tree.erase(tree.find(keys[i]));
+        });
+        report(policy, "erase half", n / 2, erase, tree.height());
+
+        if(checksum == 42) std::printf("\n");
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    std::vector<int> keys(n);
+    for(size_t i = 0; i < n; ++i) keys[i] = (int) i;
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+
+    std::printf("BinaryTree balancing policies, %zu keys\n", n);
+    run<s21::red_black_balance>("red-black", keys);
+    run<s21::avl_balance>("avl", keys);
+    run<s21::wavl_balance>("wavl", keys);
+    return 0;
+}
@@ -0,0 +1,208 @@
+#ifndef S21_CONTAINERS_FLAT_TREE
+#define S21_CONTAINERS_FLAT_TREE
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "./../vector/s21_vector.h"
+
+namespace s21 {
+    // Ordered storage over a sorted s21::vector: the backing store of flat_map, flat_set and
+    // flat_multiset. Lookups are a branchless binary search, scans walk contiguous memory, and bulk
+    // loads go through insert_range, which appends, sorts the new tail and merges it in one pass.
+    // Single inserts and erases shift the tail, so this suits read-mostly data.
+    //
+    // TValue is the stored element: the key itself for sets, std::pair<TKey, T> for maps. Among
+    // equivalent keys the element inserted first comes first (and wins when Unique is set).
+    template <typename TKey, typename TValue, typename Compare = std::less<TKey>, bool Unique = true>
+    class FlatTree {
+    public:
+        using key_type = TKey;
+        using value_type = TValue;
+        using size_type = size_t;
+        using iterator = typename s21::vector<TValue>::iterator;
+        using const_iterator = typename s21::vector<TValue>::const_iterator;
+
+    private:
+        s21::vector<TValue> m_data;
+
+        static const key_type& key_of(const value_type& item) noexcept {
+            if constexpr(std::is_same_v<value_type, key_type>) {
+                return item;
+            } else {
+                return item.first;
+            }
+        }
+
+        // First element in [first, first + count) for which before(key) is false, before being
+        // monotone (true, then false). The loop body has no data-dependent branch, which keeps the
+        // pipeline full: the compiler turns the step into a conditional move.
+        template <typename Before>
+        static iterator bound(iterator first, size_type count, Before before) {
+            if(count == 0) return first;
+            while(count > 1) {
+                size_type half = count / 2;
+                first += before(key_of(first[half - 1])) ? half : 0;
+                count -= half;
+            }
+            return first + (before(key_of(*first)) ? 1 : 0);
+        }
+
+        // Galloping search from a hint: doubles the step until the key is bracketed, then
+        // finishes with bound(). Costs O(log d) for a hint d elements away from the answer.
+        template <typename Before>
+        iterator gallop(iterator from, Before before) const {
+            iterator first = begin();
+            iterator last = end();
+            if(from < first || from > last) from = first;
+
+            if(from != last && before(key_of(*from))) {
+                size_type step = 1;
+                iterator low = from + 1;
+                while(static_cast<size_type>(last - low) > step && before(key_of(low[step - 1]))) {
+                    low += step;
+                    step *= 2;
+                }
+                return bound(low, std::min(step, static_cast<size_type>(last - low)), before);
+            }
+
+            size_type step = 1;
+            iterator high = from;
+            while(static_cast<size_type>(high - first) > step && !before(key_of(high[-static_cast<std::ptrdiff_t>(step)]))) {
+                high -= step;
+                step *= 2;
+            }
+            size_type count = std::min(step, static_cast<size_type>(high - first));
+            return bound(high - count, count, before);
+        }
+
+        static auto before_key(const key_type& key) {
+            return [&key](const key_type& other) { return Compare()(other, key); };
+        }
+
+        static auto not_after_key(const key_type& key) {
+            return [&key](const key_type& other) { return !Compare()(key, other); };
+        }
+
+        static bool equivalent(const value_type& a, const value_type& b) {
+            return !Compare()(key_of(a), key_of(b)) && !Compare()(key_of(b), key_of(a));
+        }
+
+    public:
+        FlatTree() = default;
+
+        FlatTree(const FlatTree& other) : m_data(other.m_data) {}
+
+        FlatTree(FlatTree&& other) noexcept = default;
+
+        FlatTree& operator=(const FlatTree& other) {
+            if(this != &other) {
+                FlatTree tmp(other);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        FlatTree& operator=(FlatTree&& other) noexcept = default;
+
+        ~FlatTree() = default;
+
+        iterator begin() const noexcept { return m_data.begin(); }
+
+        iterator end() const noexcept { return m_data.end(); }
+
+        size_type size() const noexcept { return m_data.size(); }
+
+        bool empty() const noexcept { return m_data.empty(); }
+
+        size_type max_size() const noexcept { return m_data.max_size(); }
+
+        size_type capacity() const noexcept { return m_data.capacity(); }
+
+        void reserve(size_type count) { m_data.reserve(count); }
+
+        void clear() noexcept { m_data.clear(); }
+
+        void swap(FlatTree& other) noexcept { m_data.swap(other.m_data); }
+
+        iterator lower_bound(const key_type& key) const { return bound(begin(), size(), before_key(key)); }
+
+        iterator upper_bound(const key_type& key) const { return bound(begin(), size(), not_after_key(key)); }
+
+        iterator find(const key_type& key) const {
+            iterator it = lower_bound(key);
+            return (it != end() && !Compare()(key, key_of(*it))) ? it : end();
+        }
+
+        bool contains(const key_type& key) const { return find(key) != end(); }
+
+        std::pair<iterator, iterator> equal_range(const key_type& key) const {
+            iterator low = lower_bound(key);
+            return {low, bound(low, end() - low, not_after_key(key))};
+        }
+
+        size_type count(const key_type& key) const {
+            std::pair<iterator, iterator> range = equal_range(key);
+            return range.second - range.first;
+        }
+
+        // Hinted lookups: cheap when the answer is near from, e.g. when probing sorted keys in order.
+        // cppcheck-suppress passedByValue
+        iterator lower_bound(iterator from, const key_type& key) const { return gallop(from, before_key(key)); }
+
+        // cppcheck-suppress passedByValue
+        iterator upper_bound(iterator from, const key_type& key) const { return gallop(from, not_after_key(key)); }
+
+        // cppcheck-suppress passedByValue
+        iterator find(iterator from, const key_type& key) const {
+            iterator it = lower_bound(from, key);
+            return (it != end() && !Compare()(key, key_of(*it))) ? it : end();
+        }
+
+        // Unique mode: rejects the value when its key is present. Multi mode: places it after its
+        // equivalents.
+        std::pair<iterator, bool> insert(const value_type& value) {
+            if constexpr(Unique) {
+                iterator pos = lower_bound(key_of(value));
+                if(pos != end() && !Compare()(key_of(value), key_of(*pos))) return {pos, false};
+                return {m_data.insert(pos, value), true};
+            } else {
+                return {m_data.insert(upper_bound(key_of(value)), value), true};
+            }
+        }
+
+        // Bulk insert in O(n + k log k) instead of k separate O(n) shifts. Existing elements keep
+        // priority over equivalent new ones, and earlier new ones over later ones.
+        template <typename InputIt>
+        void insert_range(InputIt first, InputIt last) {
+            size_type old_size = size();
+            m_data.insert(end(), first, last);
+            if(size() == old_size) return;
+
+            auto by_key = [](const value_type& a, const value_type& b) { return Compare()(key_of(a), key_of(b)); };
+            iterator middle = begin() + old_size;
+            std::stable_sort(middle, end(), by_key);
+            std::inplace_merge(begin(), middle, end(), by_key);
+
+            if constexpr(Unique) {
+                m_data.erase(std::unique(begin(), end(), equivalent), end());
+            }
+        }
+
+        // cppcheck-suppress passedByValue
+        void erase(iterator pos) {
+            if(pos >= begin() && pos < end()) m_data.erase(pos);
+        }
+
+        void shrink_to_fit() { m_data.shrink_to_fit(); }
+
+        bool operator==(const FlatTree& other) const { return std::equal(begin(), end(), other.begin(), other.end()); }
+
+        bool operator!=(const FlatTree& other) const { return !(*this == other); }
+    };
+} // namespace s21
+
+#endif
@@ -0,0 +1,291 @@
+#ifndef S21_CONTAINERS_SMALL_TREE
+#define S21_CONTAINERS_SMALL_TREE
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "s21_tree.h"
+
+namespace s21 {
+    // Ordered storage that keeps up to N elements in a sorted array inside the object and moves them
+    // into a BinaryTree when the (N + 1)-th element arrives. Small instances therefore allocate
+    // nothing, not even the tree's end sentinel. Once promoted the container stays a tree until
+    // clear(). Promotion invalidates iterators, like reallocation does for vector.
+    template <typename TKey, typename TValue, size_t N, typename Compare = std::less<TKey>,
+              typename IterReturnType = std::pair<const TKey, TValue>>
+    class SmallTree {
+        static_assert(N > 0, "SmallTree needs room for at least one inline element");
+
+    private:
+        using key_type = TKey;
+        using value_type = TValue;
+        using size_type = size_t;
+        using tree_type = BinaryTree<TKey, TValue, Compare, IterReturnType>;
+        using tree_iterator = typename tree_type::iterator;
+        using stored_type = std::remove_const_t<IterReturnType>;
+
+        static constexpr bool is_set = std::is_same_v<stored_type, TKey>;
+
+        alignas(stored_type) unsigned char m_inline[N * sizeof(stored_type)];
+        size_type m_inline_size;
+        bool m_promoted;
+        tree_type m_tree;
+
+        stored_type* slots() const noexcept {
+            return reinterpret_cast<stored_type*>(const_cast<unsigned char*>(m_inline));
+        }
+
+        static const key_type& key_of(const stored_type& item) noexcept {
+            if constexpr(is_set) {
+                return item;
+            } else {
+                return item.first;
+            }
+        }
+
+        // Index of the first inline element for which pred(key) holds, pred being monotone in key order.
+        template <typename Predicate>
+        size_type inline_bound(Predicate pred) const {
+            stored_type* data = slots();
+            size_type index = 0;
+            while(index < m_inline_size && !pred(key_of(data[index]))) ++index;
+            return index;
+        }
+
+        void inline_insert_at(size_type index, const TKey& key, const TValue& value) {
+            stored_type* data = slots();
+            for(size_type i = m_inline_size; i > index; --i) {
+                std::construct_at(data + i, std::move(data[i - 1]));
+                std::destroy_at(data + i - 1);
+            }
+            if constexpr(is_set) {
+                std::construct_at(data + index, key);
+            } else {
+                std::construct_at(data + index, key, value);
+            }
+            ++m_inline_size;
+        }
+
+        void inline_erase_at(size_type index) noexcept {
+            stored_type* data = slots();
+            std::destroy_at(data + index);
+            for(size_type i = index; i + 1 < m_inline_size; ++i) {
+                std::construct_at(data + i, std::move(data[i + 1]));
+                std::destroy_at(data + i + 1);
+            }
+            --m_inline_size;
+        }
+
+        void inline_clear() noexcept {
+            std::destroy(slots(), slots() + m_inline_size);
+            m_inline_size = 0;
+        }
+
+        // Builds the tree aside and swaps it in only once every element has been copied, so a throwing
+        // copy leaves the inline elements as they were.
+        void promote() {
+            stored_type* data = slots();
+            tree_type promoted(m_tree.get_allocator());
+            for(size_type i = 0; i < m_inline_size; ++i) {
+                if constexpr(is_set) {
+                    promoted.insert(data[i], data[i]);
+                } else {
+                    promoted.insert(data[i].first, data[i].second);
+                }
+            }
+            m_tree.swap(promoted);
+            inline_clear();
+            m_promoted = true;
+        }
+
+    public:
+        class SmallIterator {
+            friend class SmallTree;
+
+        private:
+            stored_type* m_ptr;
+            tree_iterator m_it;
+
+            explicit SmallIterator(stored_type* ptr) : m_ptr(ptr), m_it() {}
+            explicit SmallIterator(tree_iterator it) : m_ptr(nullptr), m_it(it) {}
+
+        public:
+            using reference = IterReturnType&;
+
+            SmallIterator() : m_ptr(nullptr), m_it() {}
+
+            reference operator*() const { return m_ptr ? *m_ptr : *m_it; }
+
+            const IterReturnType* operator->() const { return &(operator*()); }
+
+            SmallIterator& operator++() {
+                if(m_ptr) {
+                    ++m_ptr;
+                } else {
+                    ++m_it;
+                }
+                return *this;
+            }
+
+            SmallIterator operator++(int) {
+                SmallIterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            SmallIterator& operator--() {
+                if(m_ptr) {
+                    --m_ptr;
+                } else {
+                    --m_it;
+                }
+                return *this;
+            }
+
+            SmallIterator operator--(int) {
+                SmallIterator tmp = *this;
+                --(*this);
+                return tmp;
+            }
+
+            bool operator==(const SmallIterator& other) const { return m_ptr == other.m_ptr && m_it == other.m_it; }
+
+            bool operator!=(const SmallIterator& other) const { return !(*this == other); }
+        };
+
+        using iterator = SmallIterator;
+        using const_iterator = SmallIterator;
+
+        SmallTree() : m_inline_size(0), m_promoted(false), m_tree() {}
+
+        SmallTree(const SmallTree& other) : SmallTree() {
+            if(other.m_promoted) {
+                tree_type copy(other.m_tree);
+                m_tree.swap(copy);
+                m_promoted = true;
+            } else {
+                std::uninitialized_copy(other.slots(), other.slots() + other.m_inline_size, slots());
+                m_inline_size = other.m_inline_size;
+            }
+        }
+
+        SmallTree(SmallTree&& other) noexcept : SmallTree() { swap(other); }
+
+        SmallTree& operator=(const SmallTree& other) {
+            if(this != &other) {
+                SmallTree tmp(other);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        SmallTree& operator=(SmallTree&& other) noexcept {
+            if(this != &other) {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        ~SmallTree() { inline_clear(); }
+
+        size_type size() const noexcept { return m_promoted ? m_tree.size() : m_inline_size; }
+
+        bool empty() const noexcept { return size() == 0; }
+
+        bool is_inline() const noexcept { return !m_promoted; }
+
+        static constexpr size_type inline_capacity() noexcept { return N; }
+
+        static size_type max_size() noexcept { return tree_type::max_size(); }
+
+        iterator begin() const noexcept { return m_promoted ? iterator(m_tree.begin()) : iterator(slots()); }
+
+        iterator end() const noexcept { return m_promoted ? iterator(m_tree.end()) : iterator(slots() + m_inline_size); }
+
+        iterator lower_bound(const key_type& key) const {
+            if(m_promoted) return iterator(m_tree.lower_bound(key));
+            return iterator(slots() + inline_bound([&key](const key_type& other) { return !Compare()(other, key); }));
+        }
+
+        iterator upper_bound(const key_type& key) const {
+            if(m_promoted) return iterator(m_tree.upper_bound(key));
+            return iterator(slots() + inline_bound([&key](const key_type& other) { return Compare()(key, other); }));
+        }
+
+        iterator find(const key_type& key) const {
+            if(m_promoted) return iterator(m_tree.find(key));
+            iterator it = lower_bound(key);
+            return (it != end() && !Compare()(key, key_of(*it.m_ptr))) ? it : end();
+        }
+
+        bool contains(const key_type& key) const { return find(key) != end(); }
+
+        std::pair<iterator, bool> insert_unique(const TKey& key, const TValue& value) {
+            if(!m_promoted) {
+                size_type index = inline_bound([&key](const key_type& other) { return !Compare()(other, key); });
+                if(index < m_inline_size && !Compare()(key, key_of(slots()[index]))) return {iterator(slots() + index), false};
+                if(m_inline_size < N) {
+                    inline_insert_at(index, key, value);
+                    return {iterator(slots() + index), true};
+                }
+                promote();
+            }
+            std::pair<tree_iterator, bool> result = m_tree.insert_unique(key, value);
+            return {iterator(result.first), result.second};
+        }
+
+        // cppcheck-suppress passedByValue
+        void erase(iterator pos) noexcept {
+            if(m_promoted) {
+                m_tree.erase(pos.m_it);
+            } else if(pos.m_ptr && pos.m_ptr < slots() + m_inline_size) {
+                inline_erase_at(pos.m_ptr - slots());
+            }
+        }
+
+        void clear() noexcept {
+            inline_clear();
+            m_tree.clear();
+            m_promoted = false;
+        }
+
+        void swap(SmallTree& other) noexcept(std::is_nothrow_move_constructible_v<stored_type>) {
+            if(this == &other) return;
+            SmallTree* shorter = m_inline_size < other.m_inline_size ? this : &other;
+            SmallTree* longer = shorter == this ? &other : this;
+            stored_type* a = shorter->slots();
+            stored_type* b = longer->slots();
+            size_type common = shorter->m_inline_size;
+            for(size_type i = 0; i < common; ++i) {
+                stored_type tmp(std::move(a[i]));
+                std::destroy_at(a + i);
+                std::construct_at(a + i, std::move(b[i]));
+                std::destroy_at(b + i);
+                std::construct_at(b + i, std::move(tmp));
+            }
+            for(size_type i = common; i < longer->m_inline_size; ++i) {
+                std::construct_at(a + i, std::move(b[i]));
+                std::destroy_at(b + i);
+            }
+            std::swap(m_inline_size, other.m_inline_size);
+            std::swap(m_promoted, other.m_promoted);
+            m_tree.swap(other.m_tree);
+        }
+
+        bool operator==(const SmallTree& other) const {
+            if(size() != other.size()) return false;
+            for(iterator a = begin(), b = other.begin(); a != end(); ++a, ++b) {
+                if(!(*a == *b)) return false;
+            }
+            return true;
+        }
+
+        bool operator!=(const SmallTree& other) const { return !(*this == other); }
+    };
+} // namespace s21
+
+#endif
@@ -6,12 +6,33 @@
 #include <functional>
 #include <initializer_list>
 #include <limits>
+#include <memory>
 #include <ostream>
 #include <type_traits>
 #include <utility>
+
+#include "s21_tree_balance.h"
+
 namespace s21 {
+    // In-order neighbour links carried by every node of a threaded tree.
+    // The tail of the chain is the end sentinel, whose next link points back to the first node.
+    template <typename Node, bool Threaded>
+    struct TreeThreadLinks {};
+
+    template <typename Node>
+    struct TreeThreadLinks<Node, true> {
+        Node* next = nullptr;
+        Node* prev = nullptr;
+    };
+
+    // Balance selects the rebalancing scheme (red_black_balance, avl_balance, wavl_balance, see s21_tree_balance.h).
+    // Threaded trees keep explicit next/prev links in every node (two extra pointers per node);
+    // they survive rotations untouched and make iterator steps and begin() O(1).
+    // Allocator may be an allocator of any type: it is rebound to nodes for storage and to the stored
+    // (key, value) pair for construction, so pmr allocators reach the keys and values.
     template <typename TKey, typename TValue, typename Compare = std::less<TKey>,
-              typename IterReturnType = std::pair<const TKey, TValue>>
+              typename IterReturnType = std::pair<const TKey, TValue>, typename Balance = red_black_balance,
+              bool Threaded = false, typename Allocator = std::allocator<std::pair<const TKey, TValue>>>
     class BinaryTree {
     private:
         using key_type = TKey;
@@ -21,27 +42,63 @@ namespace s21 {
         using size_type = size_t;
         using comparator = Compare;
 
-        typedef enum { red, black } colors;
+        using balance_type = typename Balance::balance_type;
 
-        typedef struct m_Node {
-            colors color;
+        // The pair lives in a union so that the end sentinel can leave it unconstructed.
+        typedef struct m_Node : TreeThreadLinks<m_Node, Threaded> {
+            balance_type balance;
             m_Node* parent;
             m_Node* left;
             m_Node* right;
-            std::pair<const key_type, value_type> data;
 
-            m_Node() : color(red), parent(nullptr), left(nullptr), right(nullptr), data({key_type(), value_type()}) {};
-
-            explicit m_Node(std::pair<key_type, value_type> data) :
-                color(red), parent(nullptr), left(nullptr), right(nullptr), data(data) {};
+            union {
+                std::pair<const key_type, value_type> data;
+            };
 
+            m_Node() : balance(Balance::initial), parent(nullptr), left(nullptr), right(nullptr) {};
+            ~m_Node() {}
         } m_Node;
 
+        using data_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::pair<const key_type, value_type>>;
+        using data_traits = std::allocator_traits<data_allocator>;
+        using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<m_Node>;
+        using node_traits = std::allocator_traits<node_allocator>;
+
         m_Node* m_root;
         m_Node* m_end;
         size_type m_size;
+        [[no_unique_address]] data_allocator m_alloc;
+
+        m_Node* allocate_node() {
+            node_allocator nodes(m_alloc);
+            return std::construct_at(node_traits::allocate(nodes, 1));
+        }
+
+        void deallocate_node(m_Node* node) noexcept {
+            if(node == nullptr) return;
+            node_allocator nodes(m_alloc);
+            node_traits::deallocate(nodes, node, 1);
+        }
+
+        m_Node* create_node(const key_type& key, const value_type& value) {
+            m_Node* node = allocate_node();
+            try {
+                data_traits::construct(m_alloc, std::addressof(node->data), key, value);
+            }
+            catch(...) {
+                deallocate_node(node);
+                throw;
+            }
+            return node;
+        }
+
+        void destroy_node(m_Node* node) noexcept {
+            data_traits::destroy(m_alloc, std::addressof(node->data));
+            deallocate_node(node);
+        }
         friend class TreeTest;
         friend class TreeIterator;
+        friend Balance;
 
     public:
         class TreeIterator {
@@ -97,6 +154,8 @@ namespace s21 {
 
         protected:
             m_Node* next(m_Node* ptr) {
+                if constexpr(Threaded) { return ptr->next; }
+
                 if(ptr->right) {
                     ptr = ptr->right;
                     while(ptr->left) ptr = ptr->left;
@@ -113,6 +172,8 @@ namespace s21 {
             }
 
             m_Node* previous(m_Node* ptr) {
+                if constexpr(Threaded) { return ptr->prev; }
+
                 if(ptr->left) {
                     ptr = ptr->left;
                     while(ptr->right) ptr = ptr->right;
@@ -148,7 +209,12 @@ namespace s21 {
         using iterator = TreeIterator;
         using const_iterator = ConstTreeIterator;
 
-        BinaryTree() : m_root(nullptr), m_end(nullptr), m_size(0) {};
+        using allocator_type = Allocator;
+
+        BinaryTree() : BinaryTree(Allocator()) {};
+
+        explicit BinaryTree(const Allocator& alloc) : m_root(nullptr), m_end(nullptr), m_size(0), m_alloc(alloc) {};
+
         explicit BinaryTree(std::initializer_list<value_type> const& list) : BinaryTree() {
             for(const auto& value : list) { insert(value.first, value.second); }
         };
@@ -157,33 +223,43 @@ namespace s21 {
             for(const auto& value : list) { insert(value.first, value.second); }
         };
 
-        BinaryTree(const BinaryTree& other) : BinaryTree() {
-            for(iterator it = other.begin(); it != other.end(); ++it) {
-                if constexpr(std::is_same_v<IterReturnType, key_type> || std::is_same_v<IterReturnType, const key_type>) {
-                    insert(*it, *it);
-                } else {
-                    insert((*it).first, (*it).second);
-                }
-            }
-        };
+        BinaryTree(const BinaryTree& other) :
+            BinaryTree(other, std::allocator_traits<Allocator>::select_on_container_copy_construction(other.get_allocator())) {};
+
+        BinaryTree(const BinaryTree& other, const Allocator& alloc) : BinaryTree(alloc) { copy_from(other); };
 
-        BinaryTree(BinaryTree&& other) noexcept : m_root(other.m_root), m_end(other.m_end), m_size(other.m_size) {
+        BinaryTree(BinaryTree&& other) noexcept :
+            m_root(other.m_root), m_end(other.m_end), m_size(other.m_size), m_alloc(std::move(other.m_alloc)) {
             other.m_root = nullptr;
             other.m_end = nullptr;
             other.m_size = 0;
         };
 
-        BinaryTree& operator=(BinaryTree&& other) noexcept {
-            if(*this != other) {
-                m_size = other.m_size;
-                m_root = other.m_root;
-                m_end = other.m_end;
-                other.m_size = 0;
-                other.m_root = nullptr;
-                other.m_end = nullptr;
+        // Releases the current nodes, then takes other's; with unequal, non-propagating allocators the
+        // elements are copied instead.
+        BinaryTree& operator=(BinaryTree&& other) noexcept(data_traits::propagate_on_container_move_assignment::value ||
+                                                           data_traits::is_always_equal::value) {
+            if(this != &other) {
+                clear();
+                deallocate_node(m_end);
+                m_end = nullptr;
+                if constexpr(data_traits::propagate_on_container_move_assignment::value) m_alloc = std::move(other.m_alloc);
+                if(m_alloc == other.m_alloc) {
+                    m_size = other.m_size;
+                    m_root = other.m_root;
+                    m_end = other.m_end;
+                    other.m_size = 0;
+                    other.m_root = nullptr;
+                    other.m_end = nullptr;
+                } else {
+                    copy_from(other);
+                    other.clear();
+                }
             }
             return *this;
         }
+
+        allocator_type get_allocator() const noexcept { return allocator_type(m_alloc); }
         bool operator==(const BinaryTree& other) const {
             if(size() != other.size()) return false;
             auto it1 = begin();
@@ -200,24 +276,16 @@ namespace s21 {
 
         ~BinaryTree() {
             clear();
-            delete m_end;
+            deallocate_node(m_end);
         };
 
         inline size_type size() const noexcept { return m_size; }
 
         inline bool empty() const noexcept { return m_size == 0; }
 
-        inline iterator begin() const noexcept {
-            m_Node* mostleft = m_root;
-            while(mostleft && mostleft->left) mostleft = mostleft->left;
-            return iterator(mostleft, m_end);
-        }
+        inline iterator begin() const noexcept { return iterator(minimum(), m_end); }
 
-        inline const_iterator cbegin() const noexcept {
-            m_Node* mostleft = m_root;
-            while(mostleft && mostleft->left) mostleft = mostleft->left;
-            return const_iterator(mostleft, m_end);
-        }
+        inline const_iterator cbegin() const noexcept { return const_iterator(minimum(), m_end); }
 
         iterator end() const noexcept { return iterator(m_end, m_end); }
 
@@ -225,15 +293,20 @@ namespace s21 {
 
         iterator insert(const TKey& key, const TValue& value) {
             if(m_root == nullptr) {
-                m_root = new m_Node({key, value});
-                m_end = new m_Node({TKey(), TValue()});
-                m_root->color = black;
+                if(!m_end) { m_end = allocate_node(); }
+                m_root = create_node(key, value);
+                Balance::after_insert(*this, m_root);
+                if constexpr(Threaded) {
+                    m_root->next = m_end;
+                    m_end->prev = m_root;
+                    m_end->next = m_root;
+                }
                 link_end();
                 ++m_size;
                 return iterator(m_root, m_end);
             }
             unlink_end();
-            m_Node* new_node = new m_Node({key, value});
+            m_Node* new_node = create_node(key, value);
             m_Node* current = m_root;
             m_Node* parent = nullptr;
 
@@ -254,8 +327,9 @@ namespace s21 {
             } else {
                 parent->right = new_node;
             }
+            if constexpr(Threaded) { thread_in(new_node); }
 
-            balance_after_insertion(new_node);
+            Balance::after_insert(*this, new_node);
             ++m_size;
             link_end();
             return iterator(new_node, m_end);
@@ -266,52 +340,6 @@ namespace s21 {
             return {insert(key, value), true};
         }
 
-        void balance_after_insertion(m_Node* node) {
-            while(node != m_root && node->parent->color == red) {
-                m_Node* parent = node->parent;
-                m_Node* grandfather = get_grandfather(node);
-                m_Node* uncle = get_uncle(node);
-
-                if(parent == grandfather->left) {
-                    if(exists(uncle) && uncle->color == red) {
-                        parent->color = black;
-                        uncle->color = black;
-                        grandfather->color = red;
-                        node = grandfather;
-                    } else {
-                        if(node == parent->right) {
-                            node = parent;
-                            rotateLeft(node);
-                            parent = node->parent;
-                            grandfather = get_grandfather(node);
-                        }
-                        parent->color = black;
-                        grandfather->color = red;
-                        rotateRight(grandfather);
-                    }
-                } else {
-                    if(exists(uncle) && uncle->color == red) {
-                        parent->color = black;
-                        uncle->color = black;
-                        grandfather->color = red;
-                        node = grandfather;
-                    } else {
-                        if(node == parent->left) {
-                            node = parent;
-                            rotateRight(node);
-                            parent = node->parent;
-                            grandfather = get_grandfather(node);
-                        }
-                        parent->color = black;
-                        grandfather->color = red;
-                        rotateLeft(grandfather);
-                    }
-                }
-            }
-
-            m_root->color = black;
-        }
-
         void erase(iterator pos) noexcept {
             m_Node* current = pos.ptr;
             if(!exists(current)) { return; }
@@ -319,7 +347,7 @@ namespace s21 {
 
             m_Node* child = nullptr;
             m_Node* parent = nullptr;
-            colors init_color = current->color;
+            balance_type removed = current->balance;
 
             if(!exists(current->left)) {
                 child = current->right;
@@ -333,88 +361,32 @@ namespace s21 {
                 m_Node* right_most_left_child = current->right;
                 while(exists(right_most_left_child->left)) { right_most_left_child = right_most_left_child->left; }
 
-                init_color = right_most_left_child->color;
+                removed = right_most_left_child->balance;
                 child = right_most_left_child->right;
-                parent = current->parent;
 
                 if(right_most_left_child->parent != current) {
+                    parent = right_most_left_child->parent;
                     replace_node(right_most_left_child, right_most_left_child->right);
                     right_most_left_child->right = current->right;
-                    if(exists(current->right)) { current->right->parent = right_most_left_child; }
+                    current->right->parent = right_most_left_child;
                 } else {
                     parent = right_most_left_child;
                 }
                 replace_node(current, right_most_left_child);
                 right_most_left_child->left = current->left;
-                if(exists(current->left)) { current->left->parent = right_most_left_child; }
-                right_most_left_child->color = current->color;
+                current->left->parent = right_most_left_child;
+                right_most_left_child->balance = current->balance;
             }
 
-            delete current;
+            if constexpr(Threaded) { thread_out(current); }
+            destroy_node(current);
             --m_size;
 
-            if(init_color == black) { balance_after_erase(exists(child) ? child : parent); }
+            Balance::after_erase(*this, child, parent, removed);
 
             link_end();
         }
 
-        void balance_after_erase(m_Node* node) noexcept {
-            while(exists(node) && node != m_root && is_black(node)) {
-                m_Node* parent = node->parent;
-                m_Node* brother = get_brother(node);
-                if(is_left_subtree(node) && exists(brother)) {
-                    if(!is_black(brother)) {
-                        brother->color = black;
-                        parent->color = red;
-                        rotateLeft(parent);
-                        brother = parent->right;
-                    }
-                    if(is_black(brother->left) && is_black(brother->right)) {
-                        brother->color = red;
-                        node = parent;
-                    } else {
-                        if(is_black(brother->right) && exists(brother->right)) {
-                            brother->left->color = black;
-                            brother->color = red;
-                            rotateRight(brother);
-                            brother = parent->right;
-                        }
-                        brother->color = parent->color;
-                        parent->color = black;
-                        brother->right->color = black;
-                        rotateLeft(parent);
-                        node = m_root;
-                    }
-                } else if(!is_left_subtree(node) && exists(brother)) {
-                    if(!is_black(brother)) {
-                        brother->color = black;
-                        parent->color = red;
-                        rotateRight(parent);
-                        brother = parent->left;
-                    }
-                    if(is_black(brother->left) && is_black(brother->right)) {
-                        brother->color = red;
-                        node = parent;
-                    } else {
-                        if(is_black(brother->left)) {
-                            brother->right->color = black;
-                            brother->color = black;
-                            rotateLeft(brother);
-                            brother = parent->left;
-                        }
-                        brother->color = parent->color;
-                        parent->color = black;
-                        brother->left->color = black;
-                        rotateRight(parent);
-                        node = m_root;
-                    }
-                } else {
-                    node = m_root;
-                }
-            }
-            if(exists(node)) { node->color = black; }
-        }
-
         void merge(BinaryTree& other) {
             if(*this == other) return;
             for(iterator it = other.begin(); it != other.end(); ++it) {
@@ -450,7 +422,9 @@ namespace s21 {
             return exists(current) ? iterator(current, m_end) : end();
         }
 
+        // Allocators are exchanged only when they propagate on swap; otherwise they must be equal.
         void swap(BinaryTree& other) noexcept {
+            if constexpr(data_traits::propagate_on_container_swap::value) std::swap(m_alloc, other.m_alloc);
             std::swap(this->m_root, other.m_root);
             std::swap(this->m_end, other.m_end);
             std::swap(this->m_size, other.m_size);
@@ -463,35 +437,27 @@ namespace s21 {
         std::pair<iterator, iterator> equal_range(const key_type& key) const { return {lower_bound(key), upper_bound(key)}; }
 
         iterator lower_bound(const key_type& key) const {
-            m_Node* current = m_root;
-            m_Node* result = nullptr;
-
-            while(exists(current)) {
-                if(!Compare()(current->data.first, key)) {
-                    result = current;
-                    current = current->left;
-                } else {
-                    current = current->right;
-                }
-            }
-
-            return exists(result) ? iterator(result, m_end) : end();
+            return iterator(descend(m_root, nullptr, [&key](const key_type& other) { return !Compare()(other, key); }), m_end);
         }
 
         iterator upper_bound(const key_type& key) const {
-            m_Node* current = m_root;
-            m_Node* result = nullptr;
+            return iterator(descend(m_root, nullptr, [&key](const key_type& other) { return Compare()(key, other); }), m_end);
+        }
 
-            while(exists(current)) {
-                if(Compare()(key, current->data.first)) {
-                    result = current;
-                    current = current->left;
-                } else {
-                    current = current->right;
-                }
-            }
+        // Finger search: the bound is looked up starting from `from` instead of the root. The search climbs
+        // only until the key is fenced in by an ancestor and then descends, so lookups close to the finger in
+        // key order touch few nodes. An end() finger falls back to a search from the root.
+        iterator lower_bound(iterator from, const key_type& key) const {
+            return iterator(finger_bound(from.ptr, [&key](const key_type& other) { return !Compare()(other, key); }), m_end);
+        }
+
+        iterator upper_bound(iterator from, const key_type& key) const {
+            return iterator(finger_bound(from.ptr, [&key](const key_type& other) { return Compare()(key, other); }), m_end);
+        }
 
-            return exists(result) ? iterator(result, m_end) : end();
+        iterator find(iterator from, const key_type& key) const {
+            iterator it = lower_bound(from, key);
+            return (exists(it.ptr) && !Compare()(key, it.ptr->data.first)) ? it : end();
         }
 
         // cppcheck-suppress functionStatic
@@ -499,7 +465,7 @@ namespace s21 {
             if(!node) return;
 
             out << "  node" << node << " [label=\"" << node->data.first << "\\n"
-                << node->data.second << "\", color=" << (node->color == red ? "red" : "black")
+                << node->data.second << "\", color=" << Balance::dot_color(node->balance)
                 << ", shape=circle, fontcolor=white, style=filled];\n";
 
             if(node->left) {
@@ -540,10 +506,19 @@ namespace s21 {
         void clear() {
             clear_recursive(m_root);
             m_root = nullptr;
-            if(m_end) { m_end->parent = nullptr; }
+            if(m_end) {
+                m_end->parent = nullptr;
+                if constexpr(Threaded) {
+                    m_end->next = nullptr;
+                    m_end->prev = nullptr;
+                }
+            }
             m_size = 0;
         }
 
+        // Number of levels on the longest root-to-leaf path, 0 for an empty tree.
+        size_type height() const noexcept { return height_recursive(m_root); }
+
         static size_type max_size() noexcept { return std::numeric_limits<size_type>::max() / sizeof(m_Node); }
 
         static inline size_type get_node_size() noexcept { return sizeof(m_Node); }
@@ -551,11 +526,28 @@ namespace s21 {
     private:
         inline bool exists(const m_Node* const node) const noexcept { return node != nullptr && node != m_end; }
 
-        void clear_recursive(m_Node* node) const noexcept {
+        void clear_recursive(m_Node* node) noexcept {
             if(!exists(node)) return;
             clear_recursive(node->left);
             clear_recursive(node->right);
-            delete node;
+            destroy_node(node);
+        }
+
+        void copy_from(const BinaryTree& other) {
+            for(iterator it = other.begin(); it != other.end(); ++it) {
+                if constexpr(std::is_same_v<IterReturnType, key_type> || std::is_same_v<IterReturnType, const key_type>) {
+                    insert(*it, *it);
+                } else {
+                    insert((*it).first, (*it).second);
+                }
+            }
+        }
+
+        size_type height_recursive(const m_Node* node) const noexcept {
+            if(!exists(node)) return 0;
+            size_type left = height_recursive(node->left);
+            size_type right = height_recursive(node->right);
+            return 1 + (left > right ? left : right);
         }
 
         void replace_node(m_Node* a, m_Node* b) noexcept {
@@ -570,7 +562,7 @@ namespace s21 {
         }
 
         void unlink_end() const noexcept {
-            if(!exists(m_end)) return;
+            if(!m_end) return;
 
             if(m_Node* max = m_end->parent; exists(max) && max->right == m_end) { max->right = nullptr; }
             m_end->parent = nullptr;
@@ -590,22 +582,14 @@ namespace s21 {
             return node->parent->left == node;
         }
 
-        //clang-format off
-
-        m_Node* get_uncle(m_Node* node) const noexcept {
-            return exists(node->parent)
-                           ? exists(node->parent->parent)
-                                     ? (is_left_subtree(node->parent) ? node->parent->parent->right : node->parent->parent->left)
-                                     : nullptr
-                           : nullptr;
-        }
-
-        m_Node* get_brother(m_Node* node) const noexcept {
-            return exists(node->parent) ? (is_left_subtree(node) ? node->parent->right : node->parent->left) : nullptr;
+        m_Node* minimum() const noexcept {
+            if(!exists(m_root)) return m_end;
+            if constexpr(Threaded) { return m_end->next; }
+            m_Node* current = m_root;
+            while(exists(current->left)) { current = current->left; }
+            return current;
         }
 
-        m_Node* get_grandfather(m_Node* node) const noexcept { return exists(node->parent) ? node->parent->parent : nullptr; }
-
         m_Node* maximum() const noexcept {
             if(!exists(m_root)) return nullptr;
             m_Node* current = m_root;
@@ -613,8 +597,6 @@ namespace s21 {
             return current;
         }
 
-        //clang-format on
-
         void rotateLeft(m_Node* a) noexcept {
             if(!exists(a) || !exists(a->right)) return;
 
@@ -665,7 +647,79 @@ namespace s21 {
             if(exists(c)) { c->parent = a; }
         }
 
-        bool is_black(const m_Node* node) const noexcept { return !exists(node) || node->color == black; }
+        // Standard bound descent inside the subtree of current: pred is false for a prefix of the keys
+        // and true for the rest, the first node satisfying it is returned (result if there is none).
+        template <typename Predicate>
+        m_Node* descend(m_Node* current, m_Node* result, Predicate pred) const {
+            while(exists(current)) {
+                if(pred(current->data.first)) {
+                    result = current;
+                    current = current->left;
+                } else {
+                    current = current->right;
+                }
+            }
+            return exists(result) ? result : m_end;
+        }
+
+        template <typename Predicate>
+        m_Node* finger_bound(m_Node* current, Predicate pred) const {
+            if(!exists(current)) return descend(m_root, nullptr, pred);
+
+            m_Node* result = nullptr;
+            if(pred(current->data.first)) {
+                // The answer is the finger or lies before it: climb until a left fence is met.
+                while(exists(current->parent)) {
+                    if(current == current->parent->right && !pred(current->parent->data.first)) break;
+                    current = current->parent;
+                }
+            } else {
+                // The answer lies after the finger: climb until an ancestor satisfying pred fences it.
+                while(exists(current->parent)) {
+                    if(current == current->parent->left && pred(current->parent->data.first)) {
+                        result = current->parent;
+                        break;
+                    }
+                    current = current->parent;
+                }
+            }
+            return descend(current, result, pred);
+        }
+
+        // Splices a freshly attached leaf into the in-order chain. Its neighbours are the parent
+        // and whatever the parent was linked to on that side, so no search is needed.
+        void thread_in(m_Node* node) const noexcept {
+            m_Node* parent = node->parent;
+            if(!parent) {
+                node->prev = nullptr;
+                node->next = m_end;
+                m_end->prev = node;
+                m_end->next = node;
+            } else if(node == parent->left) {
+                node->next = parent;
+                node->prev = parent->prev;
+                parent->prev = node;
+                if(node->prev) {
+                    node->prev->next = node;
+                } else {
+                    m_end->next = node;
+                }
+            } else {
+                node->prev = parent;
+                node->next = parent->next;
+                parent->next = node;
+                node->next->prev = node;
+            }
+        }
+
+        void thread_out(m_Node* node) const noexcept {
+            if(node->prev) {
+                node->prev->next = node->next;
+            } else {
+                m_end->next = node->next != m_end ? node->next : nullptr;
+            }
+            node->next->prev = node->prev;
+        }
     };
 } // namespace s21
 
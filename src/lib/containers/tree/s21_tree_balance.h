@@ -0,0 +1,322 @@
+#ifndef S21_CONTAINERS_TREE_BALANCE
+#define S21_CONTAINERS_TREE_BALANCE
+
+namespace s21 {
+    // Balancing policies for BinaryTree.
+    //
+    // A policy owns the per-node balance data (balance_type) and restores its invariant after the
+    // tree has attached a new leaf (after_insert) or unlinked a node (after_erase). For erase, node is
+    // whatever took the vacated place (may be null), parent is its parent and removed is the balance
+    // data that disappeared from the tree. The end sentinel is detached while policies run, so null
+    // checks are enough. Policies are friends of the tree and rotate through its rotateLeft/rotateRight.
+
+    // Classic red-black tree: cheapest rebalancing (at most three rotations per update), height <= 2 log n.
+    struct red_black_balance {
+        enum balance_type { red, black };
+
+        static constexpr balance_type initial = red;
+
+        template <typename Node>
+        static bool is_black(const Node* node) noexcept {
+            return node == nullptr || node->balance == black;
+        }
+
+        template <typename Tree, typename Node>
+        static void after_insert(Tree& tree, Node* node) noexcept {
+            while(node != tree.m_root && node->parent->balance == red) {
+                Node* parent = node->parent;
+                Node* grandfather = parent->parent;
+
+                if(parent == grandfather->left) {
+                    Node* uncle = grandfather->right;
+                    if(!is_black(uncle)) {
+                        parent->balance = black;
+                        uncle->balance = black;
+                        grandfather->balance = red;
+                        node = grandfather;
+                    } else {
+                        if(node == parent->right) {
+                            node = parent;
+                            tree.rotateLeft(node);
+                            parent = node->parent;
+                        }
+                        parent->balance = black;
+                        grandfather->balance = red;
+                        tree.rotateRight(grandfather);
+                    }
+                } else {
+                    Node* uncle = grandfather->left;
+                    if(!is_black(uncle)) {
+                        parent->balance = black;
+                        uncle->balance = black;
+                        grandfather->balance = red;
+                        node = grandfather;
+                    } else {
+                        if(node == parent->left) {
+                            node = parent;
+                            tree.rotateRight(node);
+                            parent = node->parent;
+                        }
+                        parent->balance = black;
+                        grandfather->balance = red;
+                        tree.rotateLeft(grandfather);
+                    }
+                }
+            }
+
+            tree.m_root->balance = black;
+        }
+
+        template <typename Tree, typename Node>
+        static void after_erase(Tree& tree, Node* node, Node* parent, balance_type removed) noexcept {
+            if(removed == red) return;
+
+            while(node != tree.m_root && is_black(node)) {
+                if(node == parent->left) {
+                    Node* brother = parent->right;
+                    if(!is_black(brother)) {
+                        brother->balance = black;
+                        parent->balance = red;
+                        tree.rotateLeft(parent);
+                        brother = parent->right;
+                    }
+                    if(is_black(brother->left) && is_black(brother->right)) {
+                        brother->balance = red;
+                        node = parent;
+                        parent = node->parent;
+                    } else {
+                        if(is_black(brother->right)) {
+                            brother->left->balance = black;
+                            brother->balance = red;
+                            tree.rotateRight(brother);
+                            brother = parent->right;
+                        }
+                        brother->balance = parent->balance;
+                        parent->balance = black;
+                        brother->right->balance = black;
+                        tree.rotateLeft(parent);
+                        node = tree.m_root;
+                    }
+                } else {
+                    Node* brother = parent->left;
+                    if(!is_black(brother)) {
+                        brother->balance = black;
+                        parent->balance = red;
+                        tree.rotateRight(parent);
+                        brother = parent->left;
+                    }
+                    if(is_black(brother->left) && is_black(brother->right)) {
+                        brother->balance = red;
+                        node = parent;
+                        parent = node->parent;
+                    } else {
+                        if(is_black(brother->left)) {
+                            brother->right->balance = black;
+                            brother->balance = red;
+                            tree.rotateLeft(brother);
+                            brother = parent->left;
+                        }
+                        brother->balance = parent->balance;
+                        parent->balance = black;
+                        brother->left->balance = black;
+                        tree.rotateRight(parent);
+                        node = tree.m_root;
+                    }
+                }
+            }
+            if(node) { node->balance = black; }
+        }
+
+        static const char* dot_color(balance_type balance) noexcept { return balance == red ? "red" : "black"; }
+    };
+
+    // AVL tree: balance_type is the subtree height. Shallowest of the three (height <= 1.44 log n),
+    // so lookups are cheapest, at the price of retracing heights on every update.
+    struct avl_balance {
+        using balance_type = int;
+
+        static constexpr balance_type initial = 1;
+
+        template <typename Node>
+        static int height(const Node* node) noexcept {
+            return node ? node->balance : 0;
+        }
+
+        template <typename Node>
+        static void update(Node* node) noexcept {
+            int left = height(node->left);
+            int right = height(node->right);
+            node->balance = 1 + (left > right ? left : right);
+        }
+
+        // Restores the AVL condition at node and returns the root of its (possibly rotated) subtree.
+        template <typename Tree, typename Node>
+        static Node* fix(Tree& tree, Node* node) noexcept {
+            update(node);
+            int skew = height(node->left) - height(node->right);
+            if(skew > 1) {
+                Node* child = node->left;
+                if(height(child->left) < height(child->right)) {
+                    tree.rotateLeft(child);
+                    update(child);
+                }
+                tree.rotateRight(node);
+            } else if(skew < -1) {
+                Node* child = node->right;
+                if(height(child->right) < height(child->left)) {
+                    tree.rotateRight(child);
+                    update(child);
+                }
+                tree.rotateLeft(node);
+            } else {
+                return node;
+            }
+            update(node);
+            update(node->parent);
+            return node->parent;
+        }
+
+        // Walks up to the root, stopping as soon as a subtree keeps its old height.
+        template <typename Tree, typename Node>
+        static void retrace(Tree& tree, Node* node) noexcept {
+            while(node) {
+                int old_height = node->balance;
+                node = fix(tree, node);
+                if(node->balance == old_height) return;
+                node = node->parent;
+            }
+        }
+
+        template <typename Tree, typename Node>
+        static void after_insert(Tree& tree, Node* node) noexcept {
+            retrace(tree, node->parent);
+        }
+
+        template <typename Tree, typename Node>
+        static void after_erase(Tree& tree, Node*, Node* parent, balance_type) noexcept {
+            retrace(tree, parent);
+        }
+
+        static const char* dot_color(balance_type) noexcept { return "black"; }
+    };
+
+    // Weak AVL tree (Haeupler, Sen, Tarjan): balance_type is the rank. Insert-only workloads build the
+    // same shape as AVL, while erase needs at most two rotations and amortised O(1) rank changes,
+    // which makes it the cheaper choice for write-heavy tables. Height stays <= 2 log n.
+    struct wavl_balance {
+        using balance_type = int;
+
+        static constexpr balance_type initial = 0;
+
+        template <typename Node>
+        static int rank(const Node* node) noexcept {
+            return node ? node->balance : -1;
+        }
+
+        template <typename Node>
+        static bool is_leaf(const Node* node) noexcept {
+            return node->left == nullptr && node->right == nullptr;
+        }
+
+        template <typename Tree, typename Node>
+        static void after_insert(Tree& tree, Node* node) noexcept {
+            Node* parent = node->parent;
+            while(parent && rank(parent) == rank(node)) {
+                Node* brother = node == parent->left ? parent->right : parent->left;
+                if(rank(parent) - rank(brother) == 1) {
+                    ++parent->balance;
+                    node = parent;
+                    parent = node->parent;
+                    continue;
+                }
+
+                if(node == parent->left) {
+                    Node* inner = node->right;
+                    if(rank(node) - rank(inner) == 2) {
+                        tree.rotateRight(parent);
+                        --parent->balance;
+                    } else {
+                        tree.rotateLeft(node);
+                        tree.rotateRight(parent);
+                        ++inner->balance;
+                        --node->balance;
+                        --parent->balance;
+                    }
+                } else {
+                    Node* inner = node->left;
+                    if(rank(node) - rank(inner) == 2) {
+                        tree.rotateLeft(parent);
+                        --parent->balance;
+                    } else {
+                        tree.rotateRight(node);
+                        tree.rotateLeft(parent);
+                        ++inner->balance;
+                        --node->balance;
+                        --parent->balance;
+                    }
+                }
+                return;
+            }
+        }
+
+        template <typename Tree, typename Node>
+        static void after_erase(Tree& tree, Node* node, Node* parent, balance_type) noexcept {
+            if(!parent) return;
+
+            // A 2,2 leaf is not allowed: demote it, which may turn it into a 3-child.
+            if(is_leaf(parent) && parent->balance == 1) {
+                parent->balance = 0;
+                node = parent;
+                parent = node->parent;
+            }
+
+            while(parent && rank(parent) - rank(node) == 3) {
+                bool node_is_left = node ? node == parent->left : parent->left == nullptr;
+                Node* brother = node_is_left ? parent->right : parent->left;
+
+                if(rank(parent) - rank(brother) == 2) {
+                    --parent->balance;
+                } else if(rank(brother) - rank(brother->left) == 2 && rank(brother) - rank(brother->right) == 2) {
+                    --parent->balance;
+                    --brother->balance;
+                } else {
+                    rotate_after_erase(tree, parent, brother, node_is_left);
+                    return;
+                }
+                node = parent;
+                parent = node->parent;
+            }
+        }
+
+        template <typename Tree, typename Node>
+        static void rotate_after_erase(Tree& tree, Node* parent, Node* brother, bool node_is_left) noexcept {
+            Node* outer = node_is_left ? brother->right : brother->left;
+            if(rank(brother) - rank(outer) == 1) {
+                if(node_is_left) {
+                    tree.rotateLeft(parent);
+                } else {
+                    tree.rotateRight(parent);
+                }
+                ++brother->balance;
+                --parent->balance;
+                if(is_leaf(parent)) { --parent->balance; }
+            } else {
+                Node* inner = node_is_left ? brother->left : brother->right;
+                if(node_is_left) {
+                    tree.rotateRight(brother);
+                    tree.rotateLeft(parent);
+                } else {
+                    tree.rotateLeft(brother);
+                    tree.rotateRight(parent);
+                }
+                inner->balance += 2;
+                --brother->balance;
+                parent->balance -= 2;
+            }
+        }
+
+        static const char* dot_color(balance_type) noexcept { return "black"; }
+    };
+} // namespace s21
+
+#endif
@@ -3,6 +3,11 @@
 //
 #include <gtest/gtest.h>
 
+#include <set>
+
+#include "./../../map/s21_map.h"
+#include "./../../multiset/s21_multiset.h"
+#include "./../../set/s21_set.h"
 #include "./../../testing_include/test_include.h"
 #include "./../s21_tree.h"
 
@@ -17,6 +22,78 @@ namespace s21 {
             // Common setup if needed
         }
         void createDotFile() { int_tree.saveTreeToDot(int_tree.m_root, "./tree.dot"); }
+
+        // Returns the black height / height / rank of the subtree, or -2 when an invariant is broken.
+        template <typename Balance, typename Node>
+        static int check_node(const Node* node, const Node* end) {
+            if(node == nullptr || node == end) return std::is_same_v<Balance, wavl_balance> ? -1 : 0;
+            if(node->left && node->left != end && node->left->parent != node) return -2;
+            if(node->right && node->right != end && node->right->parent != node) return -2;
+            int left = check_node<Balance>(node->left, end);
+            int right = check_node<Balance>(node->right, end);
+            if(left == -2 || right == -2) return -2;
+            if constexpr(std::is_same_v<Balance, red_black_balance>) {
+                if(left != right) return -2;
+                if(node->balance == red_black_balance::red) {
+                    for(const Node* child : {node->left, node->right}) {
+                        if(child && child != end && child->balance == red_black_balance::red) return -2;
+                    }
+                }
+                return left + (node->balance == red_black_balance::black ? 1 : 0);
+            } else if constexpr(std::is_same_v<Balance, avl_balance>) {
+                int height = 1 + std::max(left, right);
+                if(std::abs(left - right) > 1 || node->balance != height) return -2;
+                return height;
+            } else {
+                int left_diff = node->balance - left;
+                int right_diff = node->balance - right;
+                if(left_diff < 1 || left_diff > 2 || right_diff < 1 || right_diff > 2) return -2;
+                if(left == -1 && right == -1 && node->balance != 0) return -2;
+                return node->balance;
+            }
+        }
+
+        template <typename Balance, typename Tree>
+        static bool balanced(const Tree& tree) {
+            if(tree.m_root && tree.m_root->parent) return false;
+            return check_node<Balance>(tree.m_root, tree.m_end) != -2;
+        }
+
+        template <typename Balance>
+        static void random_workload() {
+            BinaryTree<int, int, std::less<int>, std::pair<const int, int>, Balance> tree;
+            std::multiset<int> reference;
+            unsigned seed = 777;
+            for(int step = 0; step < 3000; ++step) {
+                seed = seed * 1103515245 + 12345;
+                int key = (int) ((seed >> 16) % 400);
+                if(step % 5 >= 3 && tree.contains(key)) {
+                    tree.erase(tree.find(key));
+                    reference.erase(reference.find(key));
+                } else {
+                    tree.insert(key, step);
+                    reference.insert(key);
+                }
+                if(step % 50 == 0) { ASSERT_TRUE(balanced<Balance>(tree)) << "step " << step; }
+            }
+            ASSERT_TRUE(balanced<Balance>(tree));
+            ASSERT_EQ(tree.size(), reference.size());
+            auto expected = reference.begin();
+            for(auto it = tree.begin(); it != tree.end(); ++it, ++expected) { EXPECT_EQ(it->first, *expected); }
+
+            while(!tree.empty()) {
+                tree.erase(tree.begin());
+                ASSERT_TRUE(balanced<Balance>(tree));
+            }
+        }
+
+        template <typename Balance>
+        static size_t sequential_height(int count) {
+            BinaryTree<int, int, std::less<int>, std::pair<const int, int>, Balance> tree;
+            for(int i = 0; i < count; ++i) { tree.insert(i, i); }
+            EXPECT_TRUE(balanced<Balance>(tree));
+            return tree.height();
+        }
     };
 
     TEST_F(TreeTest, DefaultConstructor) {
@@ -276,6 +353,129 @@ namespace s21 {
         for(auto it = range.first; it != range.second; ++it) { EXPECT_EQ(it->first, 10); }
         EXPECT_EQ(count, 3);
     }
+
+    TEST_F(TreeTest, RedBlackInvariants) { random_workload<red_black_balance>(); }
+
+    TEST_F(TreeTest, AvlInvariants) { random_workload<avl_balance>(); }
+
+    TEST_F(TreeTest, WavlInvariants) { random_workload<wavl_balance>(); }
+
+    TEST_F(TreeTest, HeightBounds) {
+        EXPECT_EQ(int_tree.height(), (size_t) 0);
+        EXPECT_LE(sequential_height<red_black_balance>(1023), (size_t) 20);
+        EXPECT_EQ(sequential_height<avl_balance>(1023), (size_t) 10);
+        EXPECT_EQ(sequential_height<wavl_balance>(1023), (size_t) 10);
+    }
+
+    TEST(BalancedMapTest, PoliciesSelectableFromContainers) {
+        map<int, int, std::less<int>, avl_balance> avl_map;
+        set<int, std::less<int>, wavl_balance> wavl_set;
+        multiset<int, std::less<int>, avl_balance, true> threaded_avl;
+        for(int i = 0; i < 100; ++i) {
+            avl_map.insert(i, i);
+            wavl_set.insert(99 - i);
+            threaded_avl.insert(i % 10);
+        }
+        for(int i = 0; i < 100; i += 2) {
+            avl_map.erase(avl_map.find(i));
+            wavl_set.erase(wavl_set.find(i));
+        }
+        EXPECT_EQ(avl_map.size(), (size_t) 50);
+        EXPECT_EQ(wavl_set.size(), (size_t) 50);
+        EXPECT_EQ((*avl_map.begin()).first, 1);
+        EXPECT_EQ(*wavl_set.begin(), 1);
+        EXPECT_EQ(threaded_avl.count(3), (size_t) 10);
+    }
+
+    TEST(ThreadedTreeTest, EmptyTree) {
+        BinaryTree<int, int, std::less<int>, std::pair<const int, int>, red_black_balance, true> tree;
+        EXPECT_TRUE(tree.begin() == tree.end());
+        tree.insert(1, 1);
+        tree.erase(tree.begin());
+        EXPECT_TRUE(tree.begin() == tree.end());
+        tree.insert(2, 2);
+        tree.clear();
+        EXPECT_TRUE(tree.begin() == tree.end());
+    }
+
+    TEST(ThreadedTreeTest, TraversalMatchesReference) {
+        BinaryTree<int, int, std::less<int>, std::pair<const int, int>, red_black_balance, true> tree;
+        std::multiset<int> reference;
+        unsigned seed = 12345;
+        for(int step = 0; step < 4000; ++step) {
+            seed = seed * 1103515245 + 12345;
+            int key = (int) ((seed >> 16) % 500);
+            if(step % 3 == 2 && tree.contains(key)) {
+                tree.erase(tree.find(key));
+                reference.erase(reference.find(key));
+            } else {
+                tree.insert(key, step);
+                reference.insert(key);
+            }
+        }
+        ASSERT_EQ(tree.size(), reference.size());
+
+        auto expected = reference.begin();
+        for(auto it = tree.begin(); it != tree.end(); ++it, ++expected) { EXPECT_EQ(it->first, *expected); }
+        EXPECT_TRUE(expected == reference.end());
+
+        auto backward = reference.rbegin();
+        auto it = tree.end();
+        for(size_t i = 0; i < tree.size(); ++i, ++backward) {
+            --it;
+            EXPECT_EQ(it->first, *backward);
+        }
+        EXPECT_TRUE(it == tree.begin());
+    }
+
+    TEST(ThreadedTreeTest, EraseFirstAndLast) {
+        BinaryTree<int, int, std::less<int>, std::pair<const int, int>, red_black_balance, true> tree{{1, 1}, {2, 2}, {3, 3}, {4, 4}};
+        tree.erase(tree.begin());
+        EXPECT_EQ(tree.begin()->first, 2);
+        tree.erase(--tree.end());
+        EXPECT_EQ((--tree.end())->first, 3);
+        tree.insert(0, 0);
+        tree.insert(9, 9);
+        std::vector<int> keys;
+        for(auto it = tree.begin(); it != tree.end(); ++it) { keys.push_back(it->first); }
+        EXPECT_EQ(keys, (std::vector<int>{0, 2, 3, 9}));
+    }
+
+    TEST(ThreadedTreeTest, SwapKeepsChains) {
+        BinaryTree<int, int, std::less<int>, std::pair<const int, int>, red_black_balance, true> a{{1, 1}, {2, 2}};
+        BinaryTree<int, int, std::less<int>, std::pair<const int, int>, red_black_balance, true> b{{5, 5}};
+        a.swap(b);
+        EXPECT_EQ(a.begin()->first, 5);
+        EXPECT_EQ(b.begin()->first, 1);
+        EXPECT_EQ((++b.begin())->first, 2);
+    }
+
+    TEST_F(TreeTest, FingerSearchMatchesRootSearch) {
+        for(int i = 0; i < 1000; i += 3) { int_tree.insert(i, i); }
+        for(int from = -5; from < 1005; from += 37) {
+            auto finger = int_tree.lower_bound(from);
+            for(int key = -5; key < 1005; key += 7) {
+                EXPECT_TRUE(int_tree.lower_bound(finger, key) == int_tree.lower_bound(key));
+                EXPECT_TRUE(int_tree.upper_bound(finger, key) == int_tree.upper_bound(key));
+                EXPECT_TRUE(int_tree.find(finger, key) == int_tree.find(key));
+            }
+        }
+    }
+
+    TEST_F(TreeTest, FingerSearchWithDuplicates) {
+        for(int i = 0; i < 5; ++i) {
+            int_tree.insert(10, i);
+            int_tree.insert(20, i);
+        }
+        auto finger = int_tree.upper_bound(20);
+        EXPECT_TRUE(finger == int_tree.end());
+        EXPECT_TRUE(int_tree.lower_bound(finger, 20) == int_tree.lower_bound(20));
+        auto last_ten = int_tree.lower_bound(20);
+        --last_ten;
+        EXPECT_TRUE(int_tree.lower_bound(last_ten, 10) == int_tree.begin());
+        EXPECT_TRUE(int_tree.upper_bound(int_tree.begin(), 10) == int_tree.lower_bound(20));
+        EXPECT_TRUE(int_tree.find(int_tree.begin(), 15) == int_tree.end());
+    }
 } // namespace s21
 
 int main(int argc, char** argv) {
@@ -0,0 +1,133 @@
+#ifndef S21_CONTAINERS_UNORDERED_MAP
+#define S21_CONTAINERS_UNORDERED_MAP
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+
+#include "./../hash_table/s21_hash_table.h"
+#include "./../vector/s21_vector.h"
+
+namespace s21 {
+    // Hash map with the map interface minus ordering (see HashTable). When both Hash and KeyEqual
+    // define is_transparent, find/contains/count/erase also accept any key type they can handle,
+    // e.g. std::string_view for std::string keys. Insertions may invalidate iterators.
+    template <typename TKey, typename TValue, typename Hash = std::hash<TKey>, typename KeyEqual = std::equal_to<TKey>>
+    class unordered_map {
+    private:
+        HashTable<TKey, std::pair<const TKey, TValue>, Hash, KeyEqual> m_table;
+
+        static constexpr bool is_transparent = requires {
+            typename Hash::is_transparent;
+            typename KeyEqual::is_transparent;
+        };
+
+    public:
+        using key_type = TKey;
+        using mapped_type = TValue;
+        using value_type = std::pair<const key_type, mapped_type>;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using iterator = typename HashTable<TKey, value_type, Hash, KeyEqual>::iterator;
+        using const_iterator = typename HashTable<TKey, value_type, Hash, KeyEqual>::const_iterator;
+        using size_type = size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+
+        unordered_map() = default;
+
+        explicit unordered_map(std::initializer_list<value_type> const& list) {
+            m_table.reserve(list.size());
+            for(const auto& value : list) insert(value);
+        }
+
+        unordered_map(const unordered_map& other) = default;
+        unordered_map(unordered_map&& other) noexcept = default;
+
+        unordered_map& operator=(const unordered_map& other) = default;
+        unordered_map& operator=(unordered_map&& other) noexcept = default;
+
+        bool operator==(const unordered_map& other) const { return m_table == other.m_table; }
+
+        mapped_type& operator[](const key_type& key) { return (*m_table.emplace_unique(key, key, mapped_type()).first).second; }
+
+        ~unordered_map() = default;
+
+        mapped_type& at(const key_type& key) const {
+            iterator it = m_table.find(key);
+            if(it == m_table.end()) throw std::out_of_range("Key not found");
+            return (*it).second;
+        }
+
+        iterator begin() const { return m_table.begin(); }
+        iterator end() const { return m_table.end(); }
+        bool empty() const { return m_table.empty(); }
+        size_type size() const { return m_table.size(); }
+        size_type max_size() const { return m_table.max_size(); }
+        void clear() { m_table.clear(); }
+
+        // cppcheck-suppress unusedFunction
+        size_type bucket_count() const { return m_table.bucket_count(); }
+        // cppcheck-suppress unusedFunction
+        float load_factor() const { return m_table.load_factor(); }
+        void reserve(size_type count) { m_table.reserve(count); }
+
+        std::pair<iterator, bool> insert(const value_type& value) { return m_table.emplace_unique(value.first, value); }
+
+        std::pair<iterator, bool> insert(const key_type& key, const mapped_type& obj) { return m_table.emplace_unique(key, key, obj); }
+
+        // cppcheck-suppress unusedFunction
+        std::pair<iterator, bool> insert_or_assign(const key_type& key, const mapped_type& obj) {
+            std::pair<iterator, bool> res = m_table.emplace_unique(key, key, obj);
+            if(!res.second) { (*res.first).second = obj; }
+            return res;
+        }
+
+        // cppcheck-suppress passedByValue
+        void erase(iterator pos) { m_table.erase(pos); }
+        size_type erase(const key_type& key) { return m_table.erase(key); }
+        void swap(unordered_map& other) noexcept { m_table.swap(other.m_table); }
+        void merge(unordered_map& other) {
+            if(this == &other) return;
+            for(iterator it = other.begin(); it != other.end(); ++it) { insert(*it); }
+            other.clear();
+        }
+
+        iterator find(const key_type& key) const { return m_table.find(key); }
+        bool contains(const key_type& key) const { return m_table.contains(key); }
+        size_type count(const key_type& key) const { return m_table.contains(key) ? 1 : 0; }
+
+        template <typename K>
+            requires is_transparent
+        iterator find(const K& key) const {
+            return m_table.find(key);
+        }
+
+        template <typename K>
+            requires is_transparent
+        bool contains(const K& key) const {
+            return m_table.contains(key);
+        }
+
+        template <typename K>
+            requires is_transparent
+        size_type count(const K& key) const {
+            return m_table.contains(key) ? 1 : 0;
+        }
+
+        template <typename K>
+            requires is_transparent
+        size_type erase(const K& key) {
+            return m_table.erase(key);
+        }
+
+        template <typename... Args>
+        s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+            s21::vector<std::pair<iterator, bool>> result;
+            result.reserve(sizeof...(args));
+            (result.push_back(insert(std::forward<Args>(args))), ...);
+            return result;
+        }
+    };
+} // namespace s21
+#endif
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+
+#include "./../s21_unordered_map.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+namespace {
+    struct StringHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view text) const { return std::hash<std::string_view>()(text); }
+    };
+} // namespace
+
+TEST(unorderedMapTest, DefaultConstructor) {
+    unordered_map<int, int> m;
+    EXPECT_TRUE(m.empty());
+    EXPECT_EQ(m.size(), (size_t) 0);
+}
+
+TEST(unorderedMapTest, ListConstructor) {
+    unordered_map<int, int> m{{1, 10}, {2, 20}, {3, 30}, {1, 40}};
+    EXPECT_EQ(m.size(), (size_t) 3);
+    EXPECT_EQ(m.at(1), 10);
+    int sum = 0;
+    for(const auto& item : m) sum += item.second;
+    EXPECT_EQ(sum, 60);
+}
+
+TEST(unorderedMapTest, AtThrowsOnMissingKey) {
+    unordered_map<int, int> m{{1, 1}};
+    EXPECT_THROW(m.at(2), std::out_of_range);
+    EXPECT_EQ(m.size(), (size_t) 1);
+}
+
+TEST(unorderedMapTest, SquareBracketsInsertDefault) {
+    unordered_map<std::string, int> m;
+    m["one"] = 1;
+    ++m["two"];
+    ++m["two"];
+    EXPECT_EQ(m["one"], 1);
+    EXPECT_EQ(m["two"], 2);
+    EXPECT_EQ(m["three"], 0);
+    EXPECT_EQ(m.size(), (size_t) 3);
+}
+
+TEST(unorderedMapTest, InsertOrAssign) {
+    unordered_map<int, std::string> m;
+    EXPECT_TRUE(m.insert(1, "a").second);
+    EXPECT_FALSE(m.insert({1, "b"}).second);
+    EXPECT_EQ(m.at(1), "a");
+    EXPECT_FALSE(m.insert_or_assign(1, "c").second);
+    EXPECT_EQ(m.at(1), "c");
+}
+
+TEST(unorderedMapTest, EraseAndFind) {
+    unordered_map<int, int> m;
+    for(int i = 0; i < 1000; ++i) m.insert(i, i * 2);
+    for(int i = 0; i < 1000; i += 3) m.erase(m.find(i));
+    EXPECT_EQ(m.erase(1), (size_t) 1);
+    EXPECT_EQ(m.erase(1), (size_t) 0);
+    for(int i = 2; i < 1000; ++i) {
+        if(i % 3 == 0) {
+            EXPECT_TRUE(m.find(i) == m.end());
+        } else {
+            EXPECT_EQ(m.find(i)->second, i * 2);
+        }
+    }
+    EXPECT_EQ(m.count(2), (size_t) 1);
+    EXPECT_EQ(m.count(3), (size_t) 0);
+}
+
+TEST(unorderedMapTest, HeterogeneousLookup) {
+    unordered_map<std::string, int, StringHash, std::equal_to<>> m{{"alpha", 1}, {"beta", 2}};
+    std::string_view key = "beta";
+    EXPECT_EQ(m.find(key)->second, 2);
+    EXPECT_TRUE(m.contains("alpha"));
+    EXPECT_EQ(m.count(std::string_view("gamma")), (size_t) 0);
+    EXPECT_EQ(m.erase(std::string_view("alpha")), (size_t) 1);
+    EXPECT_EQ(m.size(), (size_t) 1);
+}
+
+TEST(unorderedMapTest, CopyMoveSwapMerge) {
+    unordered_map<int, int> a{{1, 1}, {2, 2}};
+    unordered_map<int, int> b(a);
+    EXPECT_TRUE(a == b);
+    b.insert(3, 3);
+    EXPECT_FALSE(a == b);
+    unordered_map<int, int> c(std::move(b));
+    EXPECT_EQ(c.size(), (size_t) 3);
+    a.swap(c);
+    EXPECT_EQ(a.size(), (size_t) 3);
+    unordered_map<int, int> d{{4, 4}, {1, 100}};
+    a.merge(d);
+    EXPECT_EQ(a.size(), (size_t) 4);
+    EXPECT_EQ(a.at(1), 1);
+    EXPECT_TRUE(d.empty());
+    c = a;
+    EXPECT_TRUE(c == a);
+}
+
+TEST(unorderedMapTest, ReserveAvoidsRehash) {
+    unordered_map<int, int> m;
+    m.reserve(1000);
+    size_t buckets = m.bucket_count();
+    for(int i = 0; i < 1000; ++i) m.insert(i, i);
+    EXPECT_EQ(m.bucket_count(), buckets);
+    EXPECT_LE(m.load_factor(), 0.875f);
+}
+
+TEST(unorderedMapTest, InsertMany) {
+    unordered_map<int, int> m;
+    auto res = m.insert_many(std::pair<const int, int>{1, 1}, std::pair<const int, int>{1, 2});
+    EXPECT_TRUE(res[0].second);
+    EXPECT_FALSE(res[1].second);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
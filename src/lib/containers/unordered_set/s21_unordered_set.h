@@ -0,0 +1,111 @@
+#ifndef S21_CONTAINERS_UNORDERED_SET
+#define S21_CONTAINERS_UNORDERED_SET
+
+#include <functional>
+#include <initializer_list>
+
+#include "./../hash_table/s21_hash_table.h"
+#include "./../vector/s21_vector.h"
+
+namespace s21 {
+    // Hash set with the set interface minus ordering (see HashTable). Transparent Hash/KeyEqual
+    // pairs enable lookups with other key types. Insertions may invalidate iterators.
+    template <typename TKey, typename Hash = std::hash<TKey>, typename KeyEqual = std::equal_to<TKey>>
+    class unordered_set {
+    private:
+        HashTable<TKey, TKey, Hash, KeyEqual> m_table;
+
+        static constexpr bool is_transparent = requires {
+            typename Hash::is_transparent;
+            typename KeyEqual::is_transparent;
+        };
+
+    public:
+        using key_type = TKey;
+        using value_type = TKey;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using iterator = typename HashTable<TKey, TKey, Hash, KeyEqual>::iterator;
+        using const_iterator = typename HashTable<TKey, TKey, Hash, KeyEqual>::const_iterator;
+        using size_type = size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+
+        unordered_set() = default;
+
+        explicit unordered_set(std::initializer_list<TKey> const& list) {
+            m_table.reserve(list.size());
+            for(const auto& value : list) insert(value);
+        }
+
+        unordered_set(const unordered_set& other) = default;
+        unordered_set(unordered_set&& other) noexcept = default;
+
+        unordered_set& operator=(const unordered_set& other) = default;
+        unordered_set& operator=(unordered_set&& other) noexcept = default;
+
+        bool operator==(const unordered_set& other) const { return m_table == other.m_table; }
+        ~unordered_set() = default;
+
+        iterator begin() const { return m_table.begin(); }
+        iterator end() const { return m_table.end(); }
+        bool empty() const { return m_table.empty(); }
+        size_type size() const { return m_table.size(); }
+        size_type max_size() const { return m_table.max_size(); }
+        void clear() { m_table.clear(); }
+
+        // cppcheck-suppress unusedFunction
+        size_type bucket_count() const { return m_table.bucket_count(); }
+        // cppcheck-suppress unusedFunction
+        float load_factor() const { return m_table.load_factor(); }
+        void reserve(size_type count) { m_table.reserve(count); }
+
+        std::pair<iterator, bool> insert(const value_type& value) { return m_table.emplace_unique(value, value); }
+
+        // cppcheck-suppress passedByValue
+        void erase(iterator pos) { m_table.erase(pos); }
+        size_type erase(const key_type& key) { return m_table.erase(key); }
+        void swap(unordered_set& other) noexcept { m_table.swap(other.m_table); }
+        void merge(unordered_set& other) {
+            if(this == &other) return;
+            for(iterator it = other.begin(); it != other.end(); ++it) { insert(*it); }
+            other.clear();
+        }
+
+        iterator find(const key_type& key) const { return m_table.find(key); }
+        bool contains(const key_type& key) const { return m_table.contains(key); }
+        size_type count(const key_type& key) const { return m_table.contains(key) ? 1 : 0; }
+
+        template <typename K>
+            requires is_transparent
+        iterator find(const K& key) const {
+            return m_table.find(key);
+        }
+
+        template <typename K>
+            requires is_transparent
+        bool contains(const K& key) const {
+            return m_table.contains(key);
+        }
+
+        template <typename K>
+            requires is_transparent
+        size_type count(const K& key) const {
+            return m_table.contains(key) ? 1 : 0;
+        }
+
+        template <typename K>
+            requires is_transparent
+        size_type erase(const K& key) {
+            return m_table.erase(key);
+        }
+
+        template <typename... Args>
+        s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+            s21::vector<std::pair<iterator, bool>> result;
+            (result.push_back(insert(std::forward<Args>(args))), ...);
+            return result;
+        }
+    };
+} // namespace s21
+#endif
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+
+#include "./../s21_unordered_set.h"
+#include "./../testing_include/test_include.h"
+
+using namespace s21;
+
+namespace {
+    struct StringHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view text) const { return std::hash<std::string_view>()(text); }
+    };
+} // namespace
+
+TEST(unorderedSetTest, DefaultConstructor) {
+    unordered_set<int> s;
+    EXPECT_TRUE(s.empty());
+    EXPECT_TRUE(s.begin() == s.end());
+}
+
+TEST(unorderedSetTest, ListConstructor) {
+    unordered_set<int> s{1, 2, 3, 2, 1};
+    EXPECT_EQ(s.size(), (size_t) 3);
+    int sum = 0;
+    for(int value : s) sum += value;
+    EXPECT_EQ(sum, 6);
+}
+
+TEST(unorderedSetTest, InsertEraseContains) {
+    unordered_set<int> s;
+    for(int i = 0; i < 500; ++i) EXPECT_TRUE(s.insert(i).second);
+    EXPECT_FALSE(s.insert(42).second);
+    for(int i = 0; i < 500; i += 2) s.erase(s.find(i));
+    EXPECT_EQ(s.size(), (size_t) 250);
+    EXPECT_FALSE(s.contains(42));
+    EXPECT_TRUE(s.contains(43));
+    EXPECT_EQ(s.erase(43), (size_t) 1);
+    s.erase(s.end());
+    EXPECT_EQ(s.size(), (size_t) 249);
+}
+
+TEST(unorderedSetTest, HeterogeneousLookup) {
+    unordered_set<std::string, StringHash, std::equal_to<>> s{"red", "green"};
+    EXPECT_TRUE(s.contains(std::string_view("red")));
+    EXPECT_EQ(*s.find("green"), "green");
+    EXPECT_EQ(s.count(std::string_view("blue")), (size_t) 0);
+}
+
+TEST(unorderedSetTest, MergeSwapClear) {
+    unordered_set<int> a{1, 2};
+    unordered_set<int> b{2, 3};
+    a.merge(b);
+    EXPECT_EQ(a.size(), (size_t) 3);
+    EXPECT_TRUE(b.empty());
+    b.swap(a);
+    EXPECT_EQ(b.size(), (size_t) 3);
+    unordered_set<int> c(b);
+    EXPECT_TRUE(c == b);
+    c.clear();
+    EXPECT_TRUE(c.empty());
+    auto res = c.insert_many(5, 5, 6);
+    EXPECT_FALSE(res[1].second);
+    EXPECT_EQ(c.size(), (size_t) 2);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    UTIL(RUN_ALL_TESTS());
+    return 0;
+}
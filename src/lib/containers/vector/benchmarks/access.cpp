@@ -0,0 +1,63 @@
+// Element access cost under the access policy of s21_access.h. The same loops run through
+// operator[], through at() and through raw pointers. With checking off, operator[] compiles to the
+// same vectorized code as the pointer loop; at(), and operator[] with checking on, keep a compare
+// and a throwing branch per element, which blocks vectorization.
+//
+// bench_s21_vector_access is built with the default (unchecked in Release) policy and
+// bench_s21_vector_access_checked with S21_CHECKED_ACCESS=1, so running both shows the difference.
+//
+// Usage: bench_s21_vector_access [element_count] [rounds]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "./../s21_vector.h"
+
+namespace {
+    template <typename Body>
+    double measure(Body body) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(stop - start).count();
+    }
+
+    void report(const char* access, const char* phase, size_t ops, double seconds) {
+        std::printf("%-24s %-14s %10.2f Mops/s\n", access, phase, ops / seconds / 1e6);
+    }
+
+    // Sums and a scale-and-add over n elements, repeated rounds times. get(v, i) is the access under test.
+    template <typename Get>
+    void run(const char* access, s21::vector<int32_t>& x, s21::vector<int32_t>& y, size_t rounds, Get get) {
+        size_t n = x.size();
+        int64_t total = 0;
+        report(access, "sum", n * rounds, measure([&] {
+                   for(size_t r = 0; r < rounds; ++r) {
+                       for(size_t i = 0; i < n; ++i) total += get(x, i);
+                   }
+               }));
+        report(access, "y = 3x + y", n * rounds, measure([&] {
+                   for(size_t r = 0; r < rounds; ++r) {
+                       for(size_t i = 0; i < n; ++i) get(y, i) = 3 * get(x, i) + get(y, i);
+                   }
+               }));
+        if(total == 42 && y.at(0) == 42) std::printf("\n");
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    size_t rounds = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1000;
+
+    s21::vector<int32_t> x(n);
+    s21::vector<int32_t> y(n);
+    for(size_t i = 0; i < n; ++i) x[i] = static_cast<int32_t>(i & 0xFF);
+
+    std::printf("int32_t, %zu elements x %zu rounds, checked access %s\n", n, rounds, s21::checked_access ? "on" : "off");
+    run("operator[]", x, y, rounds, [](s21::vector<int32_t>& v, size_t i) -> int32_t& { return v[i]; });
+    run("at()", x, y, rounds, [](s21::vector<int32_t>& v, size_t i) -> int32_t& { return v.at(i); });
+    run("raw pointer", x, y, rounds, [](s21::vector<int32_t>& v, size_t i) -> int32_t& { return v.data()[i]; });
+    return 0;
+}
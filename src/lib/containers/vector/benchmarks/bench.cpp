@@ -0,0 +1,73 @@
+// Compares s21::vector against std::vector on growth (push_back without reserve) and on shifts
+// (insert and erase at the front), where trivially relocatable elements move with realloc and
+// memmove instead of one move constructor call per element.
+//
+// Usage: bench_s21_vector [element_count]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "./../s21_vector.h"
+
+namespace {
+    // Not trivially copyable, but safe to relocate bytewise.
+    struct Handle {
+        std::shared_ptr<int> ptr;
+        uint64_t id;
+    };
+} // namespace
+
+template <>
+struct s21::is_trivially_relocatable<Handle> : std::true_type {};
+
+namespace {
+    template <typename Body>
+    double measure(Body body) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(stop - start).count();
+    }
+
+    void report(const char* container, const char* phase, size_t ops, double seconds) {
+        std::printf("%-24s %-14s %10.2f Mops/s\n", container, phase, ops / seconds / 1e6);
+    }
+
+    template <typename Vector, typename Make>
+    void run(const char* container, size_t n, size_t shifts, Make make) {
+        Vector v;
+        report(container, "push_back", n, measure([&] {
+                   for(size_t i = 0; i < n; ++i) v.push_back(make(i));
+               }));
+        Vector small;
+        for(size_t i = 0; i < shifts; ++i) small.push_back(make(i));
+        report(container, "front insert", shifts, measure([&] {
+                   for(size_t i = 0; i < shifts; ++i) small.insert(small.begin(), make(i));
+               }));
+        report(container, "front erase", shifts, measure([&] {
+                   for(size_t i = 0; i < shifts; ++i) small.erase(small.begin());
+               }));
+        if(v.size() + small.size() == 42) std::printf("\n");
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+    size_t shifts = 20000;
+
+    std::printf("uint64_t, %zu elements\n", n);
+    auto number = [](size_t i) { return (uint64_t) i; };
+    run<s21::vector<uint64_t>>("s21::vector", n, shifts, number);
+    run<std::vector<uint64_t>>("std::vector", n, shifts, number);
+
+    std::printf("relocatable handle, %zu elements\n", n / 10);
+    std::shared_ptr<int> shared = std::make_shared<int>(1);
+    auto handle = [&shared](size_t i) { return Handle{shared, (uint64_t) i}; };
+    run<s21::vector<Handle>>("s21::vector", n / 10, shifts, handle);
+    run<std::vector<Handle>>("std::vector", n / 10, shifts, handle);
+    return 0;
+}
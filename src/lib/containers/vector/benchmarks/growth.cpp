@@ -0,0 +1,80 @@
+// Compares vector growth policies on a push_back-only workload: number of reallocations, bytes
+// they carry over (realloc may remap pages instead of copying them), unused capacity at the end
+// (averaged over a range of final sizes, since a single size can land just before or just after
+// a growth step) and push_back throughput.
+//
+// Usage: bench_s21_vector_growth [element_count]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+#include "./../s21_vector.h"
+
+namespace {
+    template <typename Body>
+    double measure(Body body) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(stop - start).count();
+    }
+
+    struct Stats {
+        size_t reallocations = 0;
+        size_t moved_bytes = 0;
+    };
+
+    template <typename Growth>
+    Stats fill(size_t n) {
+        Stats stats;
+        s21::vector<uint64_t, std::allocator<uint64_t>, 0, Growth> v;
+        for(size_t i = 0; i < n; ++i) {
+            if(v.size() == v.capacity()) {
+                ++stats.reallocations;
+                stats.moved_bytes += v.size() * sizeof(uint64_t);
+            }
+            v.push_back(i);
+        }
+        return stats;
+    }
+
+    // Mean share of the buffer left unused when the final size is spread over [n / 2, n).
+    template <typename Growth>
+    double mean_unused(size_t n) {
+        const size_t samples = 64;
+        double total = 0;
+        for(size_t s = 0; s < samples; ++s) {
+            size_t size = n / 2 + n / 2 * s / samples + 1;
+            size_t capacity = 0;
+            while(capacity < size) capacity = Growth::next_capacity(capacity, capacity + 1, sizeof(uint64_t));
+            total += double(capacity - size) / double(capacity);
+        }
+        return total / samples;
+    }
+
+    template <typename Growth>
+    void run(const char* policy, size_t n) {
+        Stats stats = fill<Growth>(n);
+        double seconds = measure([n] {
+            s21::vector<uint64_t, std::allocator<uint64_t>, 0, Growth> v;
+            for(size_t i = 0; i < n; ++i) v.push_back(i);
+            if(v.size() == 42) std::printf("\n");
+        });
+        std::printf("%-22s %6zu reallocs %10.1f MiB moved %8.1f%% unused %10.2f Mops/s\n", policy, stats.reallocations,
+                    stats.moved_bytes / 1048576.0, mean_unused<Growth>(n) * 100, n / seconds / 1e6);
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 50000000;
+
+    std::printf("uint64_t, %zu push_backs\n", n);
+    run<s21::double_growth>("double_growth", n);
+    run<s21::half_growth>("half_growth", n);
+    run<s21::page_aligned_growth<>>("page_aligned_growth", n);
+    run<s21::hugepage_aligned_growth>("hugepage_aligned", n);
+    return 0;
+}
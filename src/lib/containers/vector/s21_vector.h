@@ -2,17 +2,70 @@
 #define S21_CONTAINERS_VECTOR
 
 #include <algorithm>
+#include <concepts>
 #include <cstddef>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "./../common/s21_access.h"
+#include "s21_vector_growth.h"
+
 namespace s21 {
+    // A type is trivially relocatable when moving an object to a new address and dropping the old
+    // one is equivalent to copying its bytes. Containers then shift and grow storage with memmove
+    // and realloc instead of per-element move construction and destruction. Trivially copyable
+    // types qualify automatically; specialize this for types that own resources but hold no
+    // pointers into themselves, e.g. a struct around std::shared_ptr:
+    //
+    //     template <> struct s21::is_trivially_relocatable<Handle> : std::true_type {};
+    template <typename T>
+    struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
     template <typename T>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+    // std::pair has a user-provided assignment, so it is never trivially copyable.
+    template <typename First, typename Second>
+    struct is_trivially_relocatable<std::pair<First, Second>>
+        : std::bool_constant<is_trivially_relocatable_v<First> && is_trivially_relocatable_v<Second>> {};
+
+    // Slots for the elements a small_vector keeps inside the object. Empty for a plain vector.
+    template <typename T, size_t N>
+    struct VectorInlineBuffer {
+        alignas(T) unsigned char m_bytes[N * sizeof(T)];
+
+        T* data() const noexcept { return reinterpret_cast<T*>(const_cast<unsigned char*>(m_bytes)); }
+    };
+
+    template <typename T>
+    struct VectorInlineBuffer<T, 0> {
+        T* data() const noexcept { return nullptr; }
+    };
+
+    // Allocator is used through std::allocator_traits, so stateful and polymorphic allocators work:
+    // elements are built with allocator_traits::construct, which lets a pmr allocator pass itself on
+    // to elements that use one.
+    //
+    // The first InlineCapacity elements live in a buffer inside the object and only larger sizes
+    // go to the allocator; use it through the small_vector alias below. A plain vector (no inline
+    // buffer) allocates nothing until the first element arrives.
+    //
+    // Growth decides the capacity to move to when an insert does not fit (double_growth,
+    // half_growth, page_aligned_growth, see s21_vector_growth.h).
+    template <typename T, typename Allocator = std::allocator<T>, size_t InlineCapacity = 0, typename Growth = double_growth>
     class vector {
     public:
         using value_type = T;
+        using allocator_type = Allocator;
         using reference = T&;
         using const_reference = const T&;
         using iterator = T*;
@@ -20,98 +73,330 @@ namespace s21 {
         using size_type = size_t;
 
     private:
+        // Storage is raw memory: only [0, m_size) holds live objects, the rest of the capacity is
+        // uninitialized. Elements are created and destroyed explicitly through the allocator.
+        using alloc_traits = std::allocator_traits<Allocator>;
+
         T* m_data;
         size_t m_size;
         size_t m_capacity;
+        [[no_unique_address]] Allocator m_alloc;
+        [[no_unique_address]] VectorInlineBuffer<T, InlineCapacity> m_inline;
+
+        static constexpr bool m_relocatable = is_trivially_relocatable_v<T>;
+        // With the default allocator, relocatable storage comes from malloc so that growth can realloc
+        // in place (glibc turns large reallocs into mremap, which moves page mappings instead of bytes).
+        static constexpr bool m_reallocatable =
+            m_relocatable && std::is_same_v<Allocator, std::allocator<T>> && alignof(T) <= alignof(std::max_align_t);
+        // An allocator may also resize a block itself through reallocate(data, old_count, new_count),
+        // possibly moving it, as mmap_allocator does with mremap.
+        static constexpr bool m_allocator_reallocates =
+            m_relocatable && requires(Allocator& alloc, T* data, size_type count) {
+                { alloc.reallocate(data, count, count) } -> std::same_as<T*>;
+            };
+        // Moving a vector out of its inline buffer moves the elements themselves.
+        static constexpr bool m_nothrow_steal = InlineCapacity == 0 || std::is_nothrow_move_constructible_v<T>;
+
+        T* allocate(size_type count) {
+            if(count == 0) return nullptr;
+            if constexpr(m_reallocatable) {
+                void* data = std::malloc(count * sizeof(T));
+                if(data == nullptr) throw std::bad_alloc();
+                return static_cast<T*>(data);
+            } else {
+                return alloc_traits::allocate(m_alloc, count);
+            }
+        }
+
+        void deallocate(T* data, size_type count) noexcept {
+            if(data == nullptr) return;
+            if constexpr(m_reallocatable) {
+                std::free(data);
+            } else {
+                alloc_traits::deallocate(m_alloc, data, count);
+            }
+        }
+
+        template <typename... Args>
+        void construct(T* slot, Args&&... args) {
+            alloc_traits::construct(m_alloc, slot, std::forward<Args>(args)...);
+        }
+
+        void destroy(T* first, size_type count) noexcept {
+            for(size_type i = 0; i < count; ++i) alloc_traits::destroy(m_alloc, first + i);
+        }
+
+        // Builds count elements at first from make(i); on failure destroys the ones already built.
+        template <typename Make>
+        void construct_n(T* first, size_type count, Make make) {
+            size_type built = 0;
+            try {
+                for(; built < count; ++built) construct(first + built, make(built));
+            }
+            catch(...) {
+                destroy(first, built);
+                throw;
+            }
+        }
+
+        // Moves count elements into the uninitialized slots at target and destroys the originals.
+        void relocate(T* source, size_type count, T* target) {
+            if constexpr(m_relocatable) {
+                if(count) std::memcpy(static_cast<void*>(target), static_cast<const void*>(source), count * sizeof(T));
+            } else {
+                construct_n(target, count, [source](size_type i) -> decltype(auto) { return std::move(source[i]); });
+                destroy(source, count);
+            }
+        }
+
+        // Empty state: the inline buffer, or no storage at all for a plain vector.
+        void reset() noexcept {
+            m_data = m_inline.data();
+            m_size = 0;
+            m_capacity = InlineCapacity;
+        }
 
-        void check_capacity() {
-            if(m_size + 1 >= m_capacity) { reserve(m_capacity * 2); }
+        // Drops all elements and the storage.
+        void release() noexcept {
+            destroy(m_data, m_size);
+            if(!is_inline()) deallocate(m_data, m_capacity);
+            reset();
         }
 
-        T* resize(T* old_data, const size_t new_capacity) {
-            if(new_capacity == 0) {
-                delete[] old_data;
-                return nullptr;
+        // Takes v's elements into *this, which must be empty and hold no heap storage. A heap buffer
+        // changes hands as is; inline elements have to be relocated.
+        void steal(vector& v) noexcept(m_nothrow_steal) {
+            if(v.is_inline()) {
+                relocate(v.m_data, v.m_size, m_data);
+                m_size = v.m_size;
+                v.m_size = 0;
+                return;
             }
+            m_data = v.m_data;
+            m_size = v.m_size;
+            m_capacity = v.m_capacity;
+            v.reset();
+        }
 
-            T* new_data = new T[new_capacity];
+        // Moves the elements into a buffer of new_capacity slots, which is the inline one when they
+        // fit there. Relocatable elements travel as bytes; others are moved only when their move
+        // constructor cannot throw, otherwise copied, so a failure leaves *this intact.
+        void reallocate(size_type new_capacity) {
+            const bool to_inline = new_capacity <= InlineCapacity;
+            if(to_inline && is_inline()) return;
+            if constexpr(m_reallocatable) {
+                if(!to_inline && !is_inline()) {
+                    void* data = std::realloc(static_cast<void*>(m_data), new_capacity * sizeof(T));
+                    if(data == nullptr) throw std::bad_alloc();
+                    m_data = static_cast<T*>(data);
+                    m_capacity = new_capacity;
+                    return;
+                }
+            } else if constexpr(m_allocator_reallocates) {
+                if(!to_inline && !is_inline() && m_data != nullptr) {
+                    m_data = m_alloc.reallocate(m_data, m_capacity, new_capacity);
+                    m_capacity = new_capacity;
+                    return;
+                }
+            }
+
+            T* new_data = to_inline ? m_inline.data() : allocate(new_capacity);
+            if constexpr(m_relocatable) {
+                relocate(m_data, m_size, new_data);
+            } else {
+                try {
+                    construct_n(new_data, m_size, [this](size_type i) -> decltype(auto) { return std::move_if_noexcept(m_data[i]); });
+                }
+                catch(...) {
+                    if(!to_inline) deallocate(new_data, new_capacity);
+                    throw;
+                }
+                destroy(m_data, m_size);
+            }
+            if(!is_inline()) deallocate(m_data, m_capacity);
+            m_data = new_data;
+            m_capacity = to_inline ? InlineCapacity : new_capacity;
+        }
 
+        void grow_for(size_type extra) {
+            if(m_size + extra > m_capacity) reserve(Growth::next_capacity(m_capacity, m_size + extra, sizeof(T)));
+        }
+
+        void check_insert_position(const_iterator pos) const {
+            if(pos < begin() || pos > end()) throw std::out_of_range("Insert position out of range");
+        }
+
+        // Builds count elements from make(i) in front of index: one growth, one shift of the tail.
+        template <typename Make>
+        void insert_n(size_type index, size_type count, Make make) {
+            if(count == 0) return;
+            grow_for(count);
+            open_gap(index, count);
             try {
-                for(size_t i = 0; i < m_size; ++i) { new_data[i] = std::move(old_data[i]); }
+                construct_n(m_data + index, count, make);
             }
             catch(...) {
-                delete[] new_data;
-                throw std::bad_alloc();
+                close_gap(index, count);
+                throw;
+            }
+            m_size += count;
+        }
+
+        // A sized pass when the iterators allow it; a single-pass range is appended and rotated into place.
+        template <typename InputIt, typename Sentinel>
+        iterator insert_from(size_type index, InputIt first, Sentinel last) {
+            if constexpr(std::forward_iterator<InputIt>) {
+                size_type count = static_cast<size_type>(std::ranges::distance(first, last));
+                insert_n(index, count, [&first](size_type) -> decltype(auto) { return *first++; });
+            } else {
+                size_type old_size = m_size;
+                for(; first != last; ++first) emplace_back(*first);
+                std::rotate(begin() + index, begin() + old_size, end());
+            }
+            return begin() + index;
+        }
+
+        // Turns [index, index + count) into uninitialized slots by relocating the tail to the right.
+        // Capacity must already be sufficient.
+        void open_gap(size_type index, size_type count) {
+            if constexpr(m_relocatable) {
+                if(index < m_size) std::memmove(static_cast<void*>(m_data + index + count), static_cast<const void*>(m_data + index), (m_size - index) * sizeof(T));
+            } else {
+                for(size_type i = m_size; i-- > index;) {
+                    construct(m_data + i + count, std::move(m_data[i]));
+                    destroy(m_data + i, 1);
+                }
             }
+        }
 
-            delete[] old_data;
-            return new_data;
+        // Undoes open_gap: relocates the tail that starts at index + count back to index.
+        void close_gap(size_type index, size_type count) {
+            if constexpr(m_relocatable) {
+                if(index < m_size) std::memmove(static_cast<void*>(m_data + index), static_cast<const void*>(m_data + index + count), (m_size - index) * sizeof(T));
+            } else {
+                for(size_type i = index; i < m_size; ++i) {
+                    construct(m_data + i, std::move(m_data[i + count]));
+                    destroy(m_data + i + count, 1);
+                }
+            }
+        }
+
+        // Fills a freshly constructed (empty) vector with count elements read from first[i].
+        template <typename InputIt>
+        void construct_from(InputIt first, size_type count) {
+            try {
+                reserve(count);
+                construct_n(m_data, count, [&first](size_type i) -> decltype(auto) { return first[i]; });
+            }
+            catch(...) {
+                release();
+                throw;
+            }
+            m_size = count;
         }
 
     public:
-        vector() : m_data(nullptr), m_size(0), m_capacity(0) { reserve(5); }
+        vector() : vector(Allocator()) {}
+
+        explicit vector(const Allocator& alloc) noexcept : m_data(nullptr), m_size(0), m_capacity(0), m_alloc(alloc) { reset(); }
 
-        explicit vector(size_type n) : m_data(nullptr), m_size(0), m_capacity(0) {
-            reserve(n);
-            m_size = n;
-            std::fill_n(m_data, n, T());
+        explicit vector(size_type n, const Allocator& alloc = Allocator()) : m_data(nullptr), m_size(0), m_capacity(0), m_alloc(alloc) {
+            reset();
+            try {
+                reserve(n);
+                for(; m_size < n; ++m_size) construct(m_data + m_size);
+            }
+            catch(...) {
+                release();
+                throw;
+            }
         }
 
-        explicit vector(std::initializer_list<value_type> const& items) : m_data(nullptr), m_size(0), m_capacity(0) {
-            reserve(items.size());
-            m_size = items.size();
-            std::copy(items.begin(), items.end(), m_data);
+        explicit vector(std::initializer_list<value_type> const& items, const Allocator& alloc = Allocator()) :
+            m_data(nullptr), m_size(0), m_capacity(0), m_alloc(alloc) {
+            reset();
+            construct_from(items.begin(), items.size());
         }
 
-        vector(const vector<T>& v) : m_data(nullptr), m_size(0), m_capacity(0) {
-            reserve(v.m_size);
-            m_size = v.m_size;
-            std::copy(v.m_data, v.m_data + v.m_size, m_data);
+        vector(const vector& v) : vector(v, alloc_traits::select_on_container_copy_construction(v.m_alloc)) {}
+
+        vector(const vector& v, const Allocator& alloc) : m_data(nullptr), m_size(0), m_capacity(0), m_alloc(alloc) {
+            reset();
+            construct_from(v.m_data, v.m_size);
         }
 
-        vector(vector<T>&& v) noexcept : m_data(v.m_data), m_size(v.m_size), m_capacity(v.m_capacity) {
-            v.m_data = nullptr;
-            v.m_size = 0;
-            v.m_capacity = 0;
+        vector(vector&& v) noexcept(m_nothrow_steal) : m_data(nullptr), m_size(0), m_capacity(0), m_alloc(std::move(v.m_alloc)) {
+            reset();
+            steal(v);
         }
 
-        ~vector() { delete[] m_data; }
+        // Takes v's buffer when the allocators are equal, otherwise moves the elements one by one.
+        vector(vector&& v, const Allocator& alloc) : m_data(nullptr), m_size(0), m_capacity(0), m_alloc(alloc) {
+            reset();
+            if(m_alloc == v.m_alloc) {
+                steal(v);
+            } else {
+                construct_from(std::make_move_iterator(v.m_data), v.m_size);
+            }
+        }
 
-        vector& operator=(vector&& v) noexcept {
-            if(this != &v) {
-                delete[] m_data;
-                m_data = v.m_data;
-                m_size = v.m_size;
-                m_capacity = v.m_capacity;
-                v.m_data = nullptr;
-                v.m_size = 0;
-                v.m_capacity = 0;
+        ~vector() { release(); }
+
+        vector& operator=(vector&& v) noexcept((alloc_traits::propagate_on_container_move_assignment::value ||
+                                                alloc_traits::is_always_equal::value) &&
+                                               m_nothrow_steal) {
+            if(this == &v) return *this;
+            if constexpr(alloc_traits::propagate_on_container_move_assignment::value) {
+                release();
+                m_alloc = std::move(v.m_alloc);
+                steal(v);
+            } else {
+                if(m_alloc == v.m_alloc) {
+                    release();
+                    steal(v);
+                } else {
+                    clear();
+                    reserve(v.m_size);
+                    construct_n(m_data, v.m_size, [&v](size_type i) -> decltype(auto) { return std::move(v.m_data[i]); });
+                    m_size = v.m_size;
+                    v.clear();
+                }
             }
             return *this;
         }
 
         vector& operator=(std::initializer_list<value_type> const& items) {
+            clear();
             reserve(items.size());
+            construct_n(m_data, items.size(), [&items](size_type i) -> decltype(auto) { return items.begin()[i]; });
             m_size = items.size();
-            std::copy(items.begin(), items.end(), m_data);
             return *this;
         }
 
+        allocator_type get_allocator() const noexcept { return m_alloc; }
+
         // cppcheck-suppress passedByValue
         reference at(size_type pos) const {
             if(pos >= m_size) { throw std::out_of_range("Index out of range"); }
             return m_data[pos];
         }
 
+        // Checked only in debug builds, see s21_access.h.
         // cppcheck-suppress passedByValue
         reference operator[](size_type pos) const {
-            if(pos >= m_size) { throw std::out_of_range("Hello world"); }
-            return *(m_data + pos);
+            check_access(pos < m_size, "Index out of range");
+            return m_data[pos];
         }
 
-        const_reference front() const { return *m_data; }
+        const_reference front() const {
+            check_access(m_size > 0, "vector is empty");
+            return *m_data;
+        }
 
-        const_reference back() const { return m_data[m_size - 1]; }
+        const_reference back() const {
+            check_access(m_size > 0, "vector is empty");
+            return m_data[m_size - 1];
+        }
 
         T* data() const { return m_data; }
 
@@ -127,86 +412,203 @@ namespace s21 {
         // cppcheck-suppress passedByValue
         void reserve(size_type size) {
             if(m_capacity >= size) return;
-            m_data = resize(m_data, size);
-            if(nullptr == m_data) { throw std::bad_alloc(); }
-            m_capacity = size;
+            if(size > max_size()) throw std::length_error("Capacity exceeds max_size");
+            reallocate(size);
         }
 
         // cppcheck-suppress unusedFunction
         void shrink_to_fit() {
-            if(m_capacity > m_size) {
-                m_data = resize(m_data, m_size);
-                if(nullptr == m_data) { throw std::bad_alloc(); }
-                m_capacity = m_size;
-            }
+            if(m_capacity > m_size) reallocate(m_size);
         }
 
-        void clear() { m_size = 0; }
+        void clear() noexcept {
+            destroy(m_data, m_size);
+            m_size = 0;
+        }
 
         inline size_type size() const { return m_size; }
         // cppcheck-suppress unusedFunction
         inline size_type capacity() const { return m_capacity; }
 
-        // cppcheck-suppress passedByValue
-        iterator insert(iterator pos, const_reference value) {
-            if(pos < begin() || pos > end()) { throw std::out_of_range("Insert position out of range"); }
+        // True while the elements sit in the inline buffer; always false for a plain vector.
+        bool is_inline() const noexcept { return InlineCapacity > 0 && m_data == m_inline.data(); }
 
-            const size_t index = pos - begin();
+        static constexpr size_type inline_capacity() noexcept { return InlineCapacity; }
 
-            if(m_size >= m_capacity) { reserve(m_capacity ? m_capacity * 2 : 1); }
+        // cppcheck-suppress passedByValue
+        iterator insert(iterator pos, const_reference value) { return emplace(pos, value); }
 
-            pos = begin() + index;
+        // cppcheck-suppress passedByValue
+        iterator insert(iterator pos, value_type&& value) { return emplace(pos, std::move(value)); }
 
-            if(pos < end()) { std::move_backward(pos, end(), end() + 1); }
+        // Constructs an element from args in front of pos. Args may refer to elements of this vector.
+        template <typename... Args>
+        iterator emplace(const_iterator pos, Args&&... args) {
+            check_insert_position(pos);
 
-            *pos = value;
-            ++m_size;
+            const size_t index = pos - begin();
+            if(index == m_size) {
+                emplace_back(std::forward<Args>(args)...);
+            } else {
+                value_type item(std::forward<Args>(args)...);
+                grow_for(1);
+                open_gap(index, 1);
+                construct(m_data + index, std::move(item));
+                ++m_size;
+            }
 
-            return pos;
+            return begin() + index;
         }
 
         void erase(iterator pos) {
             if(pos < begin() || pos >= end()) { throw std::out_of_range("Hello world"); }
-            std::move(pos + 1, end(), pos);
-            m_size--;
+            destroy(pos, 1);
+            --m_size;
+            close_gap(pos - begin(), 1);
         }
 
+        // Range members below shift the tail once and grow at most once. Like insert_many, their
+        // source ranges must not refer to elements of this vector; a repeated value may.
+
         // cppcheck-suppress passedByValue
-        void push_back(const_reference value) {
-            if(m_size == m_capacity) { reserve(m_capacity ? m_capacity * 2 : 1); }
-            m_data[m_size] = value;
-            m_size++;
+        iterator insert(const_iterator pos, size_type count, const_reference value) {
+            check_insert_position(pos);
+            const size_type index = pos - begin();
+            value_type item(value);
+            insert_n(index, count, [&item](size_type) -> const_reference { return item; });
+            return begin() + index;
+        }
+
+        template <std::input_iterator InputIt>
+        iterator insert(const_iterator pos, InputIt first, InputIt last) {
+            check_insert_position(pos);
+            return insert_from(pos - begin(), first, last);
+        }
+
+        template <std::ranges::input_range Range>
+        iterator insert_range(const_iterator pos, Range&& range) {
+            check_insert_position(pos);
+            return insert_from(pos - begin(), std::ranges::begin(range), std::ranges::end(range));
+        }
+
+        template <std::ranges::input_range Range>
+        void append_range(Range&& range) {
+            insert_from(m_size, std::ranges::begin(range), std::ranges::end(range));
+        }
+
+        // Removes [first, last) and returns the iterator to the element that followed it.
+        iterator erase(const_iterator first, const_iterator last) {
+            if(first < begin() || first > last || last > end()) throw std::out_of_range("Erase range out of range");
+            const size_type index = first - begin();
+            const size_type count = last - first;
+            if(count == 0) return begin() + index;
+            destroy(m_data + index, count);
+            m_size -= count;
+            close_gap(index, count);
+            return begin() + index;
+        }
+
+        // Replaces the contents, allocating at most once for a sized range.
+        template <std::input_iterator InputIt>
+        void assign(InputIt first, InputIt last) {
+            clear();
+            insert_from(0, first, last);
+        }
+
+        // cppcheck-suppress passedByValue
+        void assign(size_type count, const_reference value) {
+            value_type item(value);
+            clear();
+            insert_n(0, count, [&item](size_type) -> const_reference { return item; });
+        }
+
+        // cppcheck-suppress passedByValue
+        void push_back(const_reference value) { emplace_back(value); }
+
+        void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+        // Constructs an element from args at the end. Args may refer to elements of this vector: on
+        // growth the element is built before the old storage goes away.
+        template <typename... Args>
+        reference emplace_back(Args&&... args) {
+            if(m_size == m_capacity) {
+                value_type item(std::forward<Args>(args)...);
+                grow_for(1);
+                construct(m_data + m_size, std::move(item));
+            } else {
+                construct(m_data + m_size, std::forward<Args>(args)...);
+            }
+            return m_data[m_size++];
         }
 
         void pop_back() {
             if(empty()) throw std::out_of_range("There are nothing to pop");
             m_size--;
+            destroy(m_data + m_size, 1);
         }
 
-        void swap(vector& other) noexcept {
+        // Allocators are exchanged only when they propagate on swap; otherwise they must be equal.
+        // Inline elements cannot trade places by pointer, so a swap involving one goes through a
+        // temporary and moves them.
+        void swap(vector& other) noexcept(m_nothrow_steal) {
+            if constexpr(InlineCapacity > 0) {
+                if(this == &other) return;
+                if(is_inline() || other.is_inline()) {
+                    vector tmp(std::move(other));
+                    other.steal(*this);
+                    steal(tmp);
+                    if constexpr(alloc_traits::propagate_on_container_swap::value) std::swap(m_alloc, other.m_alloc);
+                    return;
+                }
+            }
+            if constexpr(alloc_traits::propagate_on_container_swap::value) std::swap(m_alloc, other.m_alloc);
             std::swap(m_data, other.m_data);
             std::swap(m_size, other.m_size);
             std::swap(m_capacity, other.m_capacity);
         }
 
+        // Constructs one element from each argument in front of pos, growing the storage at most once.
+        // Like a range insert, the arguments must not refer to elements of this vector.
         template <typename... Args>
         iterator insert_many(const_iterator pos, Args&&... args) {
             if(pos < begin() || pos > end()) throw std::out_of_range("Pos is out of range");
+            constexpr size_type count = sizeof...(args);
             size_type offset = pos - begin();
-            while(m_size + sizeof...(args) > m_capacity) { check_capacity(); }
-            iterator insert_pos = begin() + offset;
-            std::move(begin() + offset, end(), begin() + offset + sizeof...(args));
-            std::initializer_list<value_type> items = {args...};
-            std::copy(items.begin(), items.end(), insert_pos);
-            m_size += sizeof...(args);
+            grow_for(count);
+            open_gap(offset, count);
+            size_type built = 0;
+            try {
+                ((construct(m_data + offset + built, std::forward<Args>(args)), ++built), ...);
+            }
+            catch(...) {
+                destroy(m_data + offset, built);
+                close_gap(offset, count);
+                throw;
+            }
+            m_size += count;
             return begin() + offset;
         }
 
         template <typename... Args>
         void insert_many_back(Args&&... args) {
-            insert_many(end(), args...);
+            insert_many(end(), std::forward<Args>(args)...);
         }
     };
+
+    // A vector that holds up to N elements without allocating, for the many short lists that
+    // never outgrow a handful of entries. Moves and swaps of an inline small_vector move elements.
+    template <typename T, size_t N, typename Allocator = std::allocator<T>, typename Growth = double_growth>
+    using small_vector = vector<T, Allocator, N, Growth>;
+
+    // Vectors whose storage comes from a std::pmr::memory_resource, e.g. a per-request
+    // monotonic_buffer_resource that is released in one step.
+    namespace pmr {
+        template <typename T>
+        using vector = s21::vector<T, std::pmr::polymorphic_allocator<T>>;
+
+        template <typename T, size_t N>
+        using small_vector = s21::small_vector<T, N, std::pmr::polymorphic_allocator<T>>;
+    } // namespace pmr
 } // namespace s21
 
 #endif
@@ -0,0 +1,49 @@
+#ifndef S21_CONTAINERS_VECTOR_GROWTH
+#define S21_CONTAINERS_VECTOR_GROWTH
+
+#include <algorithm>
+#include <cstddef>
+
+namespace s21 {
+    // Growth policies for vector.
+    //
+    // When an insert needs more room, vector asks its policy for the new capacity:
+    // next_capacity(capacity, required, element_size) must return at least required. Each
+    // built-in policy grows geometrically, so push_back stays amortized O(1). They differ in how
+    // many reallocations they do and how much memory they leave unused.
+
+    // Doubles the capacity: fewest reallocations, up to half of the buffer unused.
+    struct double_growth {
+        static size_t next_capacity(size_t capacity, size_t required, size_t) noexcept {
+            return std::max(required, capacity * 2);
+        }
+    };
+
+    // Grows by half: about 1.7 times as many reallocations as doubling, at most a third unused. A
+    // freed block can eventually be reused by a later growth step, which never happens with doubling.
+    struct half_growth {
+        static size_t next_capacity(size_t capacity, size_t required, size_t) noexcept {
+            return std::max(required, capacity + capacity / 2);
+        }
+    };
+
+    // Doubles while the buffer is smaller than Threshold bytes. Beyond that it grows by half and
+    // rounds the byte size up to a multiple of Page, so that large buffers fill whole pages (or
+    // huge pages) instead of leaving a partial one unused at the end.
+    template <size_t Threshold = (size_t(1) << 20), size_t Page = 4096>
+    struct page_aligned_growth {
+        static_assert(Page > 0 && (Page & (Page - 1)) == 0, "Page must be a power of two");
+
+        static size_t next_capacity(size_t capacity, size_t required, size_t element_size) noexcept {
+            if(capacity * element_size < Threshold) return double_growth::next_capacity(capacity, required, element_size);
+            size_t bytes = half_growth::next_capacity(capacity, required, element_size) * element_size;
+            bytes = (bytes + Page - 1) & ~(Page - 1);
+            return bytes / element_size;
+        }
+    };
+
+    // Page-aligned growth in 2 MiB steps, for buffers of hundreds of megabytes backed by huge pages.
+    using hugepage_aligned_growth = page_aligned_growth<(size_t(32) << 20), (size_t(2) << 20)>;
+} // namespace s21
+
+#endif
@@ -6,10 +6,17 @@
 #define S21_VECTOR_TEST_CPP
 
 #include <iostream>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <memory_resource>
+#include <sstream>
+#include <string>
 #include <stdexcept>
 #include <vector>
 
 #include "../s21_vector.h"
+#include "./../testing_include/counting_resource.h"
 #include "./../testing_include/test_include.h"
 #include "gtest/gtest.h"
 
@@ -65,10 +72,26 @@ TEST(vectorTest, at) {
 
 TEST(vectorTest, operatorAccessesElement) {
     s21::vector<int> v{1, 2, 3};
+#if S21_CHECKED_ACCESS
     EXPECT_THROW(v[3], std::out_of_range);
+#endif
     EXPECT_EQ(v[0], 1);
 }
 
+TEST(vectorTest, accessPolicyFollowsBuildType) {
+#ifdef NDEBUG
+    EXPECT_FALSE(s21::checked_access);
+#else
+    EXPECT_TRUE(s21::checked_access);
+#endif
+    s21::vector<int> v;
+    EXPECT_THROW(v.at(0), std::out_of_range);
+    if constexpr(s21::checked_access) {
+        EXPECT_THROW(v.front(), std::out_of_range);
+        EXPECT_THROW(v.back(), std::out_of_range);
+    }
+}
+
 TEST(vectorTest, front) {
     s21::vector<int> v{1, 2, 3};
     EXPECT_EQ(v.front(), 1);
@@ -216,6 +239,391 @@ TEST(vectorTest, insertManyBack) {
     for(int i = 0; i < v1.size(); ++i) { EXPECT_EQ(v1.at(i), result.at(i)); }
 }
 
+namespace {
+    struct Tracked {
+        static inline int alive = 0;
+        static inline int copies = 0;
+        static inline int moves = 0;
+        int value;
+
+        explicit Tracked(int v) : value(v) { ++alive; }
+        Tracked(const Tracked& other) : value(other.value) {
+            ++alive;
+            ++copies;
+        }
+        Tracked(Tracked&& other) noexcept : value(other.value) {
+            ++alive;
+            ++moves;
+        }
+        Tracked& operator=(const Tracked&) = default;
+        ~Tracked() { --alive; }
+    };
+
+    struct ThrowingMove {
+        static inline int copies = 0;
+        int value;
+
+        explicit ThrowingMove(int v) : value(v) {}
+        ThrowingMove(const ThrowingMove& other) : value(other.value) { ++copies; }
+        ThrowingMove(ThrowingMove&& other) noexcept(false) : value(other.value) {}
+    };
+
+    struct Handle {
+        std::shared_ptr<int> ptr;
+
+        explicit Handle(int v) : ptr(std::make_shared<int>(v)) {}
+    };
+} // namespace
+
+template <>
+struct s21::is_trivially_relocatable<Handle> : std::true_type {};
+
+static_assert(s21::is_trivially_relocatable_v<int>);
+static_assert(s21::is_trivially_relocatable_v<std::pair<int, double>>);
+static_assert(!s21::is_trivially_relocatable_v<std::string>);
+
+TEST(vectorTest, reserveDoesNotConstruct) {
+    Tracked::alive = 0;
+    {
+        s21::vector<Tracked> v{Tracked(1), Tracked(2)};
+        EXPECT_EQ(Tracked::alive, 2);
+        v.reserve(100);
+        EXPECT_EQ(Tracked::alive, 2);
+        v.pop_back();
+        EXPECT_EQ(Tracked::alive, 1);
+        v.insert(v.begin(), Tracked(0));
+        v.push_back(Tracked(3));
+        EXPECT_EQ(Tracked::alive, 3);
+        v.erase(v.begin() + 1);
+        EXPECT_EQ(Tracked::alive, 2);
+        EXPECT_EQ(v.at(0).value, 0);
+        EXPECT_EQ(v.at(1).value, 3);
+        v.clear();
+        EXPECT_EQ(Tracked::alive, 0);
+        v.insert_many_back(Tracked(4), Tracked(5));
+        v.shrink_to_fit();
+        EXPECT_EQ(v.capacity(), (size_t) 2);
+    }
+    EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(vectorTest, growthMovesNothrowElements) {
+    s21::vector<Tracked> v{Tracked(0)};
+    Tracked::copies = 0;
+    for(int i = 1; i < 100; ++i) v.push_back(Tracked(i));
+    EXPECT_EQ(Tracked::copies, 0);
+    for(int i = 0; i < 100; ++i) EXPECT_EQ(v.at(i).value, i);
+}
+
+TEST(vectorTest, growthCopiesThrowingMoveElements) {
+    s21::vector<ThrowingMove> v{ThrowingMove(0), ThrowingMove(1)};
+    ThrowingMove::copies = 0;
+    v.reserve(10);
+    EXPECT_EQ(ThrowingMove::copies, 2);
+    EXPECT_EQ(v.at(1).value, 1);
+}
+
+TEST(vectorTest, shrinkToFitEmptyReleasesStorage) {
+    s21::vector<int> v{1, 2, 3};
+    v.clear();
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), (size_t) 0);
+    v.push_back(7);
+    EXPECT_EQ(v.at(0), 7);
+}
+
+TEST(vectorTest, relocatableTypeGrowsAndShifts) {
+    s21::vector<Handle> v{};
+    for(int i = 0; i < 1000; ++i) v.push_back(Handle(i));
+    v.insert(v.begin(), Handle(-1));
+    v.erase(v.begin() + 500);
+    v.insert_many(v.begin() + 10, Handle(-2), Handle(-3));
+    v.shrink_to_fit();
+    EXPECT_EQ(v.size(), (size_t) 1002);
+    EXPECT_EQ(v.capacity(), (size_t) 1002);
+    EXPECT_EQ(*v.at(0).ptr, -1);
+    EXPECT_EQ(*v.at(10).ptr, -2);
+    EXPECT_EQ(*v.at(11).ptr, -3);
+    EXPECT_EQ(*v.at(12).ptr, 9);
+    EXPECT_EQ(*v.at(502).ptr, 500);
+    EXPECT_EQ(*v.at(1001).ptr, 999);
+}
+
+TEST(vectorTest, trivialTypeShiftsKeepOrder) {
+    s21::vector<int> v{};
+    for(int i = 0; i < 100; ++i) v.insert(v.begin(), i);
+    for(int i = 0; i < 50; ++i) v.erase(v.begin() + i);
+    for(int i = 0; i < 50; ++i) EXPECT_EQ(v.at(i), 98 - 2 * i);
+}
+
+TEST(vectorTest, emplaceBackConstructsInPlace) {
+    s21::vector<std::pair<std::string, int>> v{};
+    auto& item = v.emplace_back("one", 1);
+    EXPECT_EQ(item.first, "one");
+    v.emplace_back(std::string(40, 'x'), 2);
+    EXPECT_EQ(v.size(), (size_t) 2);
+    EXPECT_EQ(v.at(1).first.size(), (size_t) 40);
+}
+
+TEST(vectorTest, rvaluePushBackAndInsertDoNotCopy) {
+    s21::vector<Tracked> v{};
+    Tracked::copies = 0;
+    for(int i = 0; i < 50; ++i) v.push_back(Tracked(i));
+    v.insert(v.begin() + 10, Tracked(-1));
+    v.emplace(v.begin(), 100);
+    v.emplace(v.end(), 200);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(v.size(), (size_t) 53);
+    EXPECT_EQ(v.at(0).value, 100);
+    EXPECT_EQ(v.at(11).value, -1);
+    EXPECT_EQ(v.at(52).value, 200);
+}
+
+TEST(vectorTest, emplaceBackFromOwnElement) {
+    s21::vector<std::string> v{std::string(30, 'a')};
+    v.shrink_to_fit();
+    v.emplace_back(v.at(0));
+    v.insert(v.begin(), v.at(1));
+    EXPECT_EQ(v.size(), (size_t) 3);
+    for(size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v.at(i), std::string(30, 'a'));
+}
+
+TEST(vectorTest, insertManyForwardsMoveOnlyArguments) {
+    s21::vector<std::unique_ptr<int>> v{};
+    v.push_back(std::make_unique<int>(0));
+    v.shrink_to_fit();
+    v.insert_many(v.begin(), std::make_unique<int>(1), std::make_unique<int>(2), std::make_unique<int>(3));
+    EXPECT_EQ(v.capacity(), (size_t) 4);
+    v.insert_many_back(std::make_unique<int>(4));
+    ASSERT_EQ(v.size(), (size_t) 5);
+    EXPECT_EQ(*v.at(0), 1);
+    EXPECT_EQ(*v.at(2), 3);
+    EXPECT_EQ(*v.at(3), 0);
+    EXPECT_EQ(*v.at(4), 4);
+}
+
+
+TEST(vectorTest, pmrVectorUsesResourceForElements) {
+    CountingResource resource;
+    {
+        s21::pmr::vector<std::pmr::string> v(&resource);
+        v.emplace_back(std::string(100, 'a'));
+        v.push_back(std::pmr::string(std::string(100, 'b')));
+        EXPECT_EQ(v.at(0).get_allocator().resource(), &resource);
+        EXPECT_EQ(v.at(1).get_allocator().resource(), &resource);
+        EXPECT_GE(resource.allocations, (size_t) 3);
+        s21::pmr::vector<std::pmr::string> copy(v);
+        EXPECT_EQ(copy.get_allocator().resource(), std::pmr::get_default_resource());
+    }
+    EXPECT_EQ(resource.live_bytes, (size_t) 0);
+}
+
+TEST(vectorTest, pmrMoveBetweenResources) {
+    CountingResource first;
+    CountingResource second;
+    s21::pmr::vector<int> a{{1, 2, 3}, &first};
+    s21::pmr::vector<int> b(&second);
+    b = std::move(a);
+    EXPECT_EQ(b.get_allocator().resource(), &second);
+    EXPECT_EQ(b.size(), (size_t) 3);
+    EXPECT_EQ(b.at(2), 3);
+    s21::pmr::vector<int> c(std::move(b), &second);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(c.at(0), 1);
+}
+
+TEST(vectorTest, monotonicArena) {
+    char buffer[4096];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    s21::pmr::vector<int> v(&arena);
+    for(int i = 0; i < 100; ++i) v.push_back(i);
+    EXPECT_EQ(v.at(99), 99);
+    EXPECT_GE(reinterpret_cast<char*>(v.data()), buffer);
+    EXPECT_LT(reinterpret_cast<char*>(v.data()), buffer + sizeof(buffer));
+}
+
+TEST(vectorTest, defaultConstructorDoesNotAllocate) {
+    CountingResource resource;
+    s21::pmr::vector<int> v(&resource);
+    EXPECT_EQ(v.capacity(), (size_t) 0);
+    EXPECT_EQ(v.data(), nullptr);
+    EXPECT_EQ(resource.allocations, (size_t) 0);
+    v.push_back(1);
+    EXPECT_EQ(resource.allocations, (size_t) 1);
+}
+
+TEST(vectorTest, smallVectorStaysInline) {
+    CountingResource resource;
+    s21::pmr::small_vector<int, 4> v(&resource);
+    EXPECT_EQ(v.capacity(), (size_t) 4);
+    for(int i = 1; i < 4; ++i) v.push_back(i);
+    v.insert(v.begin(), 0);
+    v.erase(v.begin() + 1);
+    v.emplace_back(4);
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_EQ(resource.allocations, (size_t) 0);
+    EXPECT_EQ(v.at(1), 2);
+    EXPECT_EQ(v.at(3), 4);
+}
+
+TEST(vectorTest, smallVectorSpillsAndShrinksBack) {
+    Tracked::alive = 0;
+    {
+        s21::small_vector<Tracked, 2> v;
+        v.emplace_back(0);
+        v.emplace_back(1);
+        v.emplace_back(2);
+        EXPECT_FALSE(v.is_inline());
+        EXPECT_GE(v.capacity(), (size_t) 3);
+        EXPECT_EQ(Tracked::alive, 3);
+        v.pop_back();
+        v.shrink_to_fit();
+        EXPECT_TRUE(v.is_inline());
+        EXPECT_EQ(v.capacity(), (size_t) 2);
+        EXPECT_EQ(v.at(0).value, 0);
+        EXPECT_EQ(v.at(1).value, 1);
+    }
+    EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(vectorTest, smallVectorMoveAndSwap) {
+    s21::small_vector<std::string, 2> inline_items{std::string("a"), std::string("b")};
+    s21::small_vector<std::string, 2> heap_items{std::string("x"), std::string("y"), std::string("z")};
+
+    inline_items.swap(heap_items);
+    ASSERT_EQ(inline_items.size(), (size_t) 3);
+    ASSERT_EQ(heap_items.size(), (size_t) 2);
+    EXPECT_EQ(inline_items.at(2), "z");
+    EXPECT_TRUE(heap_items.is_inline());
+    EXPECT_EQ(heap_items.at(1), "b");
+
+    s21::small_vector<std::string, 2> moved(std::move(heap_items));
+    EXPECT_TRUE(moved.is_inline());
+    EXPECT_TRUE(heap_items.empty());
+    EXPECT_EQ(moved.at(0), "a");
+
+    moved = std::move(inline_items);
+    EXPECT_FALSE(moved.is_inline());
+    EXPECT_EQ(moved.at(0), "x");
+    EXPECT_TRUE(inline_items.empty());
+    EXPECT_TRUE(inline_items.is_inline());
+
+    s21::small_vector<std::string, 2> copy(moved);
+    EXPECT_EQ(copy.at(1), "y");
+}
+
+TEST(vectorTest, growthPolicies) {
+    s21::vector<int> doubling;
+    s21::vector<int, std::allocator<int>, 0, s21::half_growth> by_half;
+    for(int i = 0; i < 5; ++i) {
+        doubling.push_back(i);
+        by_half.push_back(i);
+    }
+    EXPECT_EQ(doubling.capacity(), (size_t) 8);
+    EXPECT_EQ(by_half.capacity(), (size_t) 6);
+    by_half.insert_many_back(5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    EXPECT_EQ(by_half.capacity(), (size_t) 16);
+    EXPECT_EQ(by_half.at(15), 15);
+}
+
+TEST(vectorTest, pageAlignedGrowthFillsPages) {
+    using growth = s21::page_aligned_growth<4096, 4096>;
+    EXPECT_EQ(growth::next_capacity(100, 101, 8), (size_t) 200);
+    s21::vector<double, std::allocator<double>, 0, growth> v;
+    size_t reallocations = 0;
+    for(int i = 0; i < 100000; ++i) {
+        size_t before = v.capacity();
+        v.push_back(i);
+        if(v.capacity() != before) {
+            ++reallocations;
+            if(before * sizeof(double) >= 4096) {
+                EXPECT_EQ(v.capacity() * sizeof(double) % 4096, (size_t) 0);
+            }
+        }
+    }
+    EXPECT_LT(v.capacity(), (size_t) 100000 * 3 / 2 + 512);
+    EXPECT_LT(reallocations, (size_t) 40);
+}
+
+TEST(vectorTest, rangeInsertShiftsTailOnce) {
+    Tracked::alive = 0;
+    {
+        s21::vector<Tracked> v;
+        v.reserve(200);
+        for(int i = 0; i < 100; ++i) v.emplace_back(i);
+        std::vector<Tracked> source;
+        for(int i = 0; i < 10; ++i) source.emplace_back(-i);
+
+        Tracked::copies = 0;
+        Tracked::moves = 0;
+        auto it = v.insert(v.begin() + 50, source.begin(), source.end());
+        EXPECT_EQ(it, v.begin() + 50);
+        EXPECT_EQ(Tracked::copies, 10);
+        EXPECT_EQ(Tracked::moves, 50);
+        EXPECT_EQ(v.at(59).value, -9);
+        EXPECT_EQ(v.at(60).value, 50);
+
+        Tracked::moves = 0;
+        it = v.erase(v.begin() + 50, v.begin() + 60);
+        EXPECT_EQ(Tracked::moves, 50);
+        EXPECT_EQ(it->value, 50);
+        EXPECT_EQ(v.size(), (size_t) 100);
+        EXPECT_EQ(Tracked::alive, 110);
+    }
+    EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(vectorTest, rangeInsertGrowsOnce) {
+    CountingResource resource;
+    s21::pmr::vector<int> v({1, 2, 3}, &resource);
+    resource.allocations = 0;
+    std::vector<int> source(1000, 7);
+    v.insert(v.begin() + 1, source.begin(), source.end());
+    EXPECT_EQ(resource.allocations, (size_t) 1);
+    EXPECT_EQ(v.size(), (size_t) 1003);
+    EXPECT_EQ(v.at(0), 1);
+    EXPECT_EQ(v.at(1000), 7);
+    EXPECT_EQ(v.at(1001), 2);
+}
+
+TEST(vectorTest, insertRepeatedValue) {
+    s21::vector<std::string> v{std::string("a"), std::string("b")};
+    v.insert(v.begin() + 1, 3, v.at(0));
+    ASSERT_EQ(v.size(), (size_t) 5);
+    EXPECT_EQ(v.at(3), "a");
+    EXPECT_EQ(v.at(4), "b");
+    v.insert(v.end(), 0, std::string("x"));
+    EXPECT_EQ(v.size(), (size_t) 5);
+    EXPECT_THROW(v.insert(v.end() + 1, 1, std::string("x")), std::out_of_range);
+}
+
+TEST(vectorTest, insertFromSinglePassRange) {
+    std::istringstream input("4 5 6");
+    s21::vector<int> v{1, 2, 3};
+    v.insert(v.begin() + 1, std::istream_iterator<int>(input), std::istream_iterator<int>());
+    s21::vector<int> expected{1, 4, 5, 6, 2, 3};
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin(), expected.end()));
+}
+
+TEST(vectorTest, assignAndAppendRange) {
+    s21::vector<int> v{9, 9};
+    std::list<int> source{1, 2, 3};
+    v.assign(source.begin(), source.end());
+    EXPECT_EQ(v.size(), (size_t) 3);
+    EXPECT_EQ(v.at(2), 3);
+    v.append_range(source);
+    v.append_range(std::vector<int>{4});
+    EXPECT_EQ(v.size(), (size_t) 7);
+    EXPECT_EQ(v.at(5), 3);
+    EXPECT_EQ(v.at(6), 4);
+    v.assign(4, 8);
+    EXPECT_EQ(v.size(), (size_t) 4);
+    EXPECT_EQ(v.at(3), 8);
+    v.erase(v.begin(), v.end());
+    EXPECT_TRUE(v.empty());
+    EXPECT_THROW(v.erase(v.begin(), v.begin() + 1), std::out_of_range);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     UTIL(RUN_ALL_TESTS());
@@ -2,6 +2,7 @@
 #ifndef S21_CONTAINERS
 #define S21_CONTAINERS
 
+#include "containers/deque/s21_deque.h"
 #include "containers/list/s21_list.h"
 #include "containers/map/s21_map.h"
 #include "containers/queue/s21_queue.h"
@@ -7,5 +7,22 @@
 
 #include "containers/array/s21_array.h"
 #include "containers/multiset/s21_multiset.h"
+#include "containers/art_map/s21_art_map.h"
+#include "containers/bitmap_set/s21_bitmap_set.h"
+#include "containers/concurrent_vector/s21_concurrent_vector.h"
+#include "containers/counted_multiset/s21_counted_multiset.h"
+#include "containers/flat_map/s21_flat_map.h"
+#include "containers/flat_multiset/s21_flat_multiset.h"
+#include "containers/flat_set/s21_flat_set.h"
+#include "containers/huge_vector/s21_huge_vector.h"
+#include "containers/mapped_vector/s21_mapped_vector.h"
+#include "containers/merged_view/s21_merged_view.h"
+#include "containers/parallel/s21_parallel.h"
+#include "containers/simd/s21_simd.h"
+#include "containers/small_map/s21_small_map.h"
+#include "containers/small_set/s21_small_set.h"
+#include "containers/soa_vector/s21_soa_vector.h"
+#include "containers/unordered_map/s21_unordered_map.h"
+#include "containers/unordered_set/s21_unordered_set.h"
 
 #endif // S21_CONTAINERSPLUS_H